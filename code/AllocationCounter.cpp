@@ -0,0 +1,124 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Replacements of the global operator new and delete that count allocations, compiled in with CENTIPEDE_ALLOC_TRACKING.
+The counters are relaxed atomics, so counting is safe from any thread and costs one uncontended add per call.
+*/
+
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef CENTIPEDE_ALLOC_TRACKING
+
+static std::atomic<uint64_t> allocationTotal(0);
+static std::atomic<uint64_t> freeTotal(0);
+static std::atomic<uint64_t> byteTotal(0);
+
+/*
+Allocates and counts a block.
+- Input: size in bytes, alignment for over-aligned types or 0 for the default.
+- Output: Returns the block, or nullptr if the system is out of memory.
+*/
+static void* countedAllocate(std::size_t size, std::size_t alignment) {
+    allocationTotal.fetch_add(1, std::memory_order_relaxed);
+    byteTotal.fetch_add(size, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    if (alignment == 0) {
+        return std::malloc(size);
+    }
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+// Frees and counts a block from countedAllocate(); alignment must be the one it was allocated with.
+static void countedFree(void* block, std::size_t alignment) {
+    if (block == nullptr) {
+        return;
+    }
+    freeTotal.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+    if (alignment != 0) {
+        _aligned_free(block);
+        return;
+    }
+#else
+    (void)alignment;
+#endif
+    std::free(block);
+}
+
+// Allocates a block, throwing std::bad_alloc when out of memory as operator new must.
+static void* countedAllocateOrThrow(std::size_t size, std::size_t alignment) {
+    void* block = countedAllocate(size, alignment);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new(std::size_t size) { return countedAllocateOrThrow(size, 0); }
+void* operator new[](std::size_t size) { return countedAllocateOrThrow(size, 0); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size, 0); }
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return countedAllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* block) noexcept { countedFree(block, 0); }
+void operator delete[](void* block) noexcept { countedFree(block, 0); }
+void operator delete(void* block, std::size_t) noexcept { countedFree(block, 0); }
+void operator delete[](void* block, std::size_t) noexcept { countedFree(block, 0); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { countedFree(block, 0); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { countedFree(block, 0); }
+void operator delete(void* block, std::align_val_t alignment) noexcept {
+    countedFree(block, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* block, std::align_val_t alignment) noexcept {
+    countedFree(block, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* block, std::size_t, std::align_val_t alignment) noexcept {
+    countedFree(block, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* block, std::size_t, std::align_val_t alignment) noexcept {
+    countedFree(block, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* block, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    countedFree(block, static_cast<std::size_t>(alignment));
+}
+void operator delete[](void* block, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    countedFree(block, static_cast<std::size_t>(alignment));
+}
+
+// - Output: Returns the allocation totals so far.
+AllocationCount getAllocationCount() {
+    return {allocationTotal.load(std::memory_order_relaxed), freeTotal.load(std::memory_order_relaxed),
+            byteTotal.load(std::memory_order_relaxed)};
+}
+
+#else
+
+// - Output: Returns zeros; allocation tracking is not compiled in.
+AllocationCount getAllocationCount() {
+    return {0, 0, 0};
+}
+
+#endif
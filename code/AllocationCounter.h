@@ -0,0 +1,34 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Global heap allocation counter. When CENTIPEDE_ALLOC_TRACKING is defined (CMake option, off by default) the global
+operator new and delete are replaced by versions that count every allocation and free before passing it on to malloc
+and free. The profiler turns the counts into allocations per frame, and centipede_headless --check-allocs uses them to
+check that the simulation does not touch the heap once it is warmed up. Without the option nothing is replaced and the
+counts stay zero.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+// Totals since the program started, over every thread
+struct AllocationCount {
+    uint64_t allocations;
+    uint64_t frees;
+    uint64_t bytes;       // Bytes requested by all allocations
+};
+
+AllocationCount getAllocationCount();
+
+// - Output: Returns true if the allocation hooks are compiled in.
+inline bool isAllocationTrackingEnabled() {
+#ifdef CENTIPEDE_ALLOC_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,81 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Writing and validating the asset bundle.
+*/
+
+#include "AssetBundle.h"
+#include <cstring>
+#include <fstream>
+
+static const char BUNDLE_MAGIC[4] = {'C', 'P', 'A', 'K'};
+
+// - Output: Returns offset rounded up to the next multiple of BUNDLE_ALIGNMENT.
+static uint64_t alignOffset(uint64_t offset) {
+    return (offset + BUNDLE_ALIGNMENT - 1) / BUNDLE_ALIGNMENT * BUNDLE_ALIGNMENT;
+}
+
+/*
+Writes a bundle holding the packed atlas and the font.
+- Input: path of the bundle, atlas image built by packAtlas, rects of every sprite in it, font file contents.
+- Output: Returns false if the file cannot be written.
+*/
+bool writeAssetBundle(const std::string& path, const sf::Image& atlas, const sf::IntRect* rects,
+                      const std::vector<char>& font) {
+    BundleHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC));
+    header.version = BUNDLE_VERSION;
+    header.atlasWidth = atlas.getSize().x;
+    header.atlasHeight = atlas.getSize().y;
+    header.spriteCount = SPRITE_COUNT;
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        header.spriteRects[i][0] = rects[i].left;
+        header.spriteRects[i][1] = rects[i].top;
+        header.spriteRects[i][2] = rects[i].width;
+        header.spriteRects[i][3] = rects[i].height;
+    }
+    header.pixelOffset = alignOffset(sizeof(header));
+    header.pixelSize = static_cast<uint64_t>(header.atlasWidth) * header.atlasHeight * 4;
+    header.fontOffset = alignOffset(header.pixelOffset + header.pixelSize);
+    header.fontSize = font.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    const char padding[BUNDLE_ALIGNMENT] = {};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(padding, static_cast<std::streamsize>(header.pixelOffset - sizeof(header)));
+    out.write(reinterpret_cast<const char*>(atlas.getPixelsPtr()), static_cast<std::streamsize>(header.pixelSize));
+    out.write(padding, static_cast<std::streamsize>(header.fontOffset - header.pixelOffset - header.pixelSize));
+    out.write(font.data(), static_cast<std::streamsize>(font.size()));
+    return static_cast<bool>(out);
+}
+
+AssetBundle::AssetBundle() : header(nullptr) {}
+
+/*
+Maps a bundle and checks that it was written for this version of the game and that every block lies inside the file.
+- Input: path of the bundle.
+- Output: Returns false if the bundle is missing, truncated or from another version.
+*/
+bool AssetBundle::open(const std::string& path) {
+    header = nullptr;
+    if (!file.open(path) || file.getSize() < sizeof(BundleHeader)) {
+        return false;
+    }
+    const BundleHeader* candidate = reinterpret_cast<const BundleHeader*>(file.getData());
+    uint64_t fileSize = file.getSize();
+    bool valid = std::memcmp(candidate->magic, BUNDLE_MAGIC, sizeof(BUNDLE_MAGIC)) == 0 &&
+                 candidate->version == BUNDLE_VERSION && candidate->spriteCount == SPRITE_COUNT &&
+                 candidate->pixelSize == static_cast<uint64_t>(candidate->atlasWidth) * candidate->atlasHeight * 4 &&
+                 candidate->pixelOffset <= fileSize && candidate->pixelSize <= fileSize - candidate->pixelOffset &&
+                 candidate->fontOffset <= fileSize && candidate->fontSize <= fileSize - candidate->fontOffset;
+    if (!valid) {
+        file.close();
+        return false;
+    }
+    header = candidate;
+    return true;
+}
@@ -0,0 +1,75 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The asset bundle holds every game asset in one file, written at build time by centipede_pack: the sprite atlas already
+decoded and packed as raw RGBA pixels, the rectangle of every sprite inside it, and the font file. The game maps the
+bundle into memory and uploads the pixels straight from the mapping, so startup opens one file and decodes no PNGs.
+
+Layout: a BundleHeader, then the atlas pixels and the font bytes at the offsets it records. Numbers are stored in the
+byte order of the machine that built the bundle, which is fine since it is built next to the game binary.
+*/
+
+#pragma once
+
+#include "MappedFile.h"
+#include "TextureAtlas.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+const uint32_t BUNDLE_VERSION = 1;        // Bumped whenever the layout changes, old bundles are then rejected
+const uint64_t BUNDLE_ALIGNMENT = 64;     // Alignment of the pixel and font blocks inside the file
+
+struct BundleHeader {
+    char magic[4];                        // "CPAK"
+    uint32_t version;
+    uint32_t atlasWidth;
+    uint32_t atlasHeight;
+    uint32_t spriteCount;                 // Must match SPRITE_COUNT of the game reading it
+    int32_t spriteRects[SPRITE_COUNT][4]; // Left, top, width and height of every sprite in the atlas
+    uint64_t pixelOffset;                 // RGBA8 atlas pixels, atlasWidth * atlasHeight * 4 bytes
+    uint64_t pixelSize;
+    uint64_t fontOffset;                  // Font file contents, as read from disk
+    uint64_t fontSize;
+};
+
+bool writeAssetBundle(const std::string& path, const sf::Image& atlas, const sf::IntRect* rects,
+                      const std::vector<char>& font);
+
+class AssetBundle {
+public:
+    AssetBundle();
+
+    bool open(const std::string& path);
+
+    // - Output: Returns the size of the atlas in pixels.
+    unsigned int getAtlasWidth() const { return header->atlasWidth; }
+    unsigned int getAtlasHeight() const { return header->atlasHeight; }
+
+    // - Output: Returns the RGBA pixels of the atlas, row by row, inside the mapped file.
+    const uint8_t* getAtlasPixels() const {
+        return file.getData() + header->pixelOffset;
+    }
+
+    // - Output: Returns the rectangle of a sprite inside the atlas.
+    sf::IntRect getRect(SpriteId id) const {
+        const int32_t* rect = header->spriteRects[id];
+        return sf::IntRect(rect[0], rect[1], rect[2], rect[3]);
+    }
+
+    // - Output: Returns the font file contents inside the mapped file; valid for as long as the bundle is open.
+    const void* getFontData() const {
+        return file.getData() + header->fontOffset;
+    }
+
+    size_t getFontSize() const {
+        return static_cast<size_t>(header->fontSize);
+    }
+
+private:
+    MappedFile file;
+    const BundleHeader* header;   // Points at the start of the mapped file
+};
@@ -0,0 +1,89 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Decision logic of the scripted AI player.
+*/
+
+#include "AutoPlayer.h"
+#include <cmath>
+
+const float DODGE_MARGIN = 40.f;     // Distance around the ship inside which a segment or a spider is dodged
+const float AIM_TOLERANCE = 4.f;     // Horizontal distance from the aim point at which the ship stops moving
+
+/*
+Picks the controls for the next tick.
+- Input: world before the tick, deltaTime is the length of the tick in seconds (used to turn the movement of the last
+  tick into a speed).
+- Output: Returns the keys to hold during the tick.
+*/
+InputState AutoPlayer::decide(const GameWorld& world, float deltaTime) const {
+    InputState input;
+    input.fire = true;
+
+    FloatRect ship = world.getSpaceshipBounds();
+    float shipCenter = ship.left + ship.width / 2.f;
+    FloatRect danger(ship.left - DODGE_MARGIN, ship.top - DODGE_MARGIN, ship.width + 2.f * DODGE_MARGIN,
+                     ship.height + 2.f * DODGE_MARGIN);
+
+    // Dodge: move away from the closest threat inside the margin, towards the side with more room if it is centered
+    bool threatened = false;
+    float threatCenter = 0.f;
+    float threatDistance = 0.f;
+    auto considerThreat = [&](const FloatRect& bounds) {
+        if (!bounds.intersects(danger)) {
+            return;
+        }
+        float center = bounds.left + bounds.width / 2.f;
+        float distance = std::fabs(center - shipCenter);
+        if (!threatened || distance < threatDistance) {
+            threatened = true;
+            threatCenter = center;
+            threatDistance = distance;
+        }
+    };
+
+    // Aim: the segment lowest on the screen is the most dangerous one
+    bool hasTarget = false;
+    float targetY = 0.f;
+    float aimX = 0.f;
+    for (const auto& centipede : world.centipedes) {
+        size_t first = centipede.getFirstIndex();
+        for (size_t i = 0; i < centipede.getSegmentCount(); ++i) {
+            FloatRect bounds = centipede.getSegmentBounds(world.segments, i);
+            considerThreat(bounds);
+            if (bounds.top > ship.top || (hasTarget && bounds.top <= targetY)) {
+                continue;
+            }
+
+            // Lead the segment by its speed over the time the laser needs to climb to it
+            float speedX = (world.segments.x[first + i] - world.segments.previousX[first + i]) / deltaTime;
+            float flightTime = (ship.top - bounds.top) / world.config.laserSpeed;
+            float leadX = bounds.left + bounds.width / 2.f + speedX * flightTime;
+            hasTarget = true;
+            targetY = bounds.top;
+            aimX = std::min(std::max(leadX, 0.f), static_cast<float>(world.config.worldWidth));
+        }
+    }
+    for (const auto& spider : world.spiders) {
+        if (spider.getIsAlive()) {
+            considerThreat(spider.getGlobalBounds());
+        }
+    }
+
+    if (threatened) {
+        bool goLeft = threatCenter > shipCenter || (threatCenter == shipCenter && shipCenter > world.config.worldWidth / 2.f);
+        input.left = goLeft;
+        input.right = !goLeft;
+        return input;
+    }
+
+    if (hasTarget) {
+        float offset = aimX - shipCenter;
+        input.left = offset < -AIM_TOLERANCE;
+        input.right = offset > AIM_TOLERANCE;
+    }
+    return input;
+}
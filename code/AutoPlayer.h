@@ -0,0 +1,20 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Scripted AI player. Every tick it looks at the world and picks the controls a player would: it dodges a centipede
+segment or the spider that is about to reach the ship, and otherwise lines the ship up under the lowest centipede
+segment, leading it by the time the laser needs to get there, and keeps firing. The choice depends only on the world
+state, so a game played by the bot is as reproducible as a recorded one.
+*/
+
+#pragma once
+
+#include "GameWorld.h"
+
+class AutoPlayer {
+public:
+    InputState decide(const GameWorld& world, float deltaTime) const;
+};
@@ -0,0 +1,482 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Benchmark suite for the hot paths of the simulation core, each run at several scales:
+    centipede_update   ECE_Centipede::update on one centipede of 1 to 10000 segments (ns per segment)
+    mushroom_query     MushroomField::findFirstOverlap on fields of 30 to 100000 mushrooms (ns per query)
+    laser_centipede    resolving 1 to 1000 lasers against a group of centipedes, splits included (ns per laser)
+    headless_tick      full GameWorld::step with scripted input at several tick rates (ns per tick)
+    swarm_tick         full ticks of swarm games with 16 to 512 centipedes on --threads threads (ns per tick)
+    stress_tick        full ticks of levels/stress.level (4K world, 5000 mushrooms, 300 centipedes) with 1 to 64
+                       spiders on --threads threads (ns per tick)
+    laser_world        one GameWorld tick with 4 to 1024 lasers in flight over 64 centipedes (ns per laser)
+    laser_spiders      the same with 64 spiders, as on the stress level (ns per laser)
+    snapshot_capture   GameSnapshot::capture of a game in progress with 1 to 512 centipedes (ns per snapshot)
+    snapshot_restore   GameSnapshot::restore of the same snapshots (ns per snapshot)
+
+Every benchmark is calibrated to run a batch of at least --min-time / SAMPLES seconds, then timed over SAMPLES
+batches. The results are printed as a table on stderr and as JSON on stdout (or to --out FILE), so runs of
+different commits can be diffed.
+
+Usage: centipede_bench [--filter TEXT] [--min-time SECONDS] [--threads N] [--out FILE] [--stress-level FILE]
+--stress-level replaces the level file of stress_tick, which is levels/stress.level of the source tree by default.
+*/
+
+#include "GameSnapshot.h"
+#include "GameWorld.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef CENTIPEDE_STRESS_LEVEL
+#define CENTIPEDE_STRESS_LEVEL "levels/stress.level"
+#endif
+
+typedef std::chrono::steady_clock BenchClock;
+
+const int SAMPLES = 5;               // Timed batches per benchmark
+const double CALIBRATION_SECONDS = 0.002; // Shortest batch used while calibrating the repetition count
+
+// Result of one benchmark at one scale
+struct BenchResult {
+    std::string name;
+    long long param;                 // Scale of the run: segments, mushrooms, lasers or tick rate
+    long long repetitions;           // Repetitions in each timed batch
+    double opsPerRepetition;
+    double medianNsPerOp;
+    double minNsPerOp;
+};
+
+/*
+A benchmark body runs a number of repetitions and returns the time they took in seconds. Bodies time themselves so
+per-repetition setup (restoring a world that the previous repetition changed) can be left out of the measurement.
+*/
+typedef std::function<double(long long repetitions)> BenchBody;
+
+// Keeps the optimizer from removing work whose result is otherwise unused
+static volatile long long benchSink;
+
+/*
+Calibrates the repetition count of a body and times it.
+- Input: name and param identify the run, opsPerRepetition converts repetitions into operations, minTime is the
+  total timed duration wanted.
+- Output: Returns the result with median and best time per operation over the samples.
+*/
+static BenchResult runBenchmark(const std::string& name, long long param, double opsPerRepetition, double minTime,
+                                const BenchBody& body) {
+    double batchTime = std::max(minTime / SAMPLES, CALIBRATION_SECONDS);
+    long long repetitions = 1;
+    double seconds = body(repetitions);
+    while (seconds < batchTime && repetitions < (1LL << 40)) {
+        // Grow towards the target batch time, at most 10x per step
+        double scale = seconds > 0.0 ? std::min(10.0, 1.2 * batchTime / seconds) : 10.0;
+        repetitions = std::max(repetitions + 1, static_cast<long long>(repetitions * scale));
+        seconds = body(repetitions);
+    }
+
+    double samples[SAMPLES];
+    for (int i = 0; i < SAMPLES; ++i) {
+        samples[i] = body(repetitions) * 1e9 / (repetitions * opsPerRepetition);
+    }
+    std::sort(samples, samples + SAMPLES);
+
+    BenchResult result;
+    result.name = name;
+    result.param = param;
+    result.repetitions = repetitions;
+    result.opsPerRepetition = opsPerRepetition;
+    result.medianNsPerOp = samples[SAMPLES / 2];
+    result.minNsPerOp = samples[0];
+    return result;
+}
+
+// - Output: Returns the seconds elapsed since start.
+static double secondsSince(BenchClock::time_point start) {
+    return std::chrono::duration<double>(BenchClock::now() - start).count();
+}
+
+/*
+centipede_update: one centipede of the given length moving across an empty screen.
+*/
+static BenchResult benchCentipedeUpdate(int segmentCount, double minTime) {
+    EntitySizes sizes;
+    SegmentArena arena;
+    arena.reserve(segmentCount);
+    ECE_Centipede centipede(arena, sizes.centipedeHead, sizes.centipedeBody, segmentCount, Vec2f(100.f, 100.f));
+    float deltaTime = 1.f / SIM_TICK_RATE;
+
+    return runBenchmark("centipede_update", segmentCount, segmentCount, minTime, [&](long long repetitions) {
+        BenchClock::time_point start = BenchClock::now();
+        for (long long i = 0; i < repetitions; ++i) {
+            centipede.update(arena, deltaTime, CENTIPEDE_SPEED);
+        }
+        double seconds = secondsSince(start);
+        benchSink = static_cast<long long>(arena.x[0]);
+        return seconds;
+    });
+}
+
+/*
+mushroom_query: laser-sized boxes queried against a field where one cell in four holds a mushroom.
+*/
+static BenchResult benchMushroomQuery(int mushroomCount, double minTime) {
+    const int QUERIES = 1024;
+    EntitySizes sizes;
+    int side = static_cast<int>(std::ceil(std::sqrt(4.0 * mushroomCount)));
+    MushroomField field;
+    field.resize(sizes.mushroom, side, side);
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<> cellDist(0, side - 1);
+    while (static_cast<int>(field.getCount()) < mushroomCount) {
+        field.place(cellDist(gen), cellDist(gen));
+    }
+
+    std::vector<FloatRect> queries(QUERIES);
+    std::uniform_real_distribution<float> xDist(0.f, side * sizes.mushroom.x);
+    std::uniform_real_distribution<float> yDist(0.f, side * sizes.mushroom.y);
+    for (auto& query : queries) {
+        query = FloatRect(Vec2f(xDist(gen), yDist(gen)), sizes.laser);
+    }
+
+    return runBenchmark("mushroom_query", mushroomCount, QUERIES, minTime, [&](long long repetitions) {
+        long long hits = 0;
+        MushroomCell cell;
+        BenchClock::time_point start = BenchClock::now();
+        for (long long i = 0; i < repetitions; ++i) {
+            for (const FloatRect& query : queries) {
+                hits += field.findFirstOverlap(query, cell);
+            }
+        }
+        double seconds = secondsSince(start);
+        benchSink = hits;
+        return seconds;
+    });
+}
+
+/*
+laser_centipede: lasers scattered over the screen, each moving for one tick, resolved against ten full-length
+centipedes the way GameWorld does it: each laser is swept against every centipede and hits the segment it reaches
+first. The centipedes are
+restored before every repetition, outside the timed region, so each repetition sees the same hits and splits.
+*/
+static BenchResult benchLaserCentipede(int laserCount, double minTime) {
+    const int CENTIPEDES = 10;
+    EntitySizes sizes;
+    SegmentArena initialArena;
+    std::vector<ECE_Centipede> initialCentipedes;
+    initialArena.reserve(CENTIPEDES * CENTIPEDE_SEGMENTS);
+    for (int i = 0; i < CENTIPEDES; ++i) {
+        Vec2f start(40.f + i * (SCREEN_WIDTH - 80.f) / CENTIPEDES, TOP_BUFFER);
+        initialCentipedes.emplace_back(initialArena, sizes.centipedeHead, sizes.centipedeBody, CENTIPEDE_SEGMENTS, start);
+    }
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> xDist(0.f, SCREEN_WIDTH);
+    std::uniform_real_distribution<float> yDist(0.f, SCREEN_HEIGHT);
+    std::vector<FloatRect> lasers(laserCount);
+    for (auto& laser : lasers) {
+        laser = FloatRect(Vec2f(xDist(gen), yDist(gen)), sizes.laser);
+    }
+
+    SegmentArena arena;
+    std::vector<ECE_Centipede> centipedes;
+    Vec2f laserDisplacement(0.f, -LASER_SPEED / SIM_TICK_RATE);
+    arena.reserve(initialArena.size());
+    centipedes.reserve(CENTIPEDES * CENTIPEDE_SEGMENTS);
+
+    return runBenchmark("laser_centipede", laserCount, laserCount, minTime, [&](long long repetitions) {
+        double seconds = 0.0;
+        int score = 0;
+        for (long long i = 0; i < repetitions; ++i) {
+            arena = initialArena;
+            centipedes = initialCentipedes;
+
+            BenchClock::time_point start = BenchClock::now();
+            for (const FloatRect& laser : lasers) {
+                size_t hitCentipede = 0;
+                size_t hitSegment = 0;
+                float firstImpact = 2.f; // Later than any impact within the tick
+                for (size_t c = 0; c < centipedes.size(); ++c) {
+                    size_t segment;
+                    float impact;
+                    if (centipedes[c].findLaserHit(arena, laser, laserDisplacement, segment, impact) && impact < firstImpact) {
+                        hitCentipede = c;
+                        hitSegment = segment;
+                        firstImpact = impact;
+                    }
+                }
+                if (firstImpact <= 1.f && centipedes[hitCentipede].hitByLaser(hitSegment, centipedes, score) &&
+                    centipedes[hitCentipede].getSegmentCount() == 0) {
+                    centipedes.erase(centipedes.begin() + hitCentipede);
+                }
+            }
+            seconds += secondsSince(start);
+        }
+        benchSink = score;
+        return seconds;
+    });
+}
+
+static ThreadPool* benchPool = nullptr; // Pool given to the swarm games, set from --threads
+static GameConfig stressConfig;          // Level of stress_tick, loaded from --stress-level
+
+/*
+Runs complete simulation ticks with the ship sweeping the bottom of the screen while firing. A new game is started
+whenever one ends, so every tick does real work.
+- Input: name and param of the result, tickRate of the simulation, config of every game, pool for the world.
+*/
+static BenchResult benchGameTicks(const char* name, int param, int tickRate, const GameConfig& config, ThreadPool* pool,
+                                  double minTime) {
+    GameWorld world(EntitySizes(), config);
+    world.setThreadPool(pool);
+    world.reset(1);
+    unsigned int games = 1;
+    long long tick = 0;
+    float deltaTime = 1.f / tickRate;
+
+    InputState left;
+    left.left = left.fire = true;
+    InputState right;
+    right.right = right.fire = true;
+    long long sweepTicks = tickRate * 3 / 2; // Time for the ship to cross most of the screen
+
+    return runBenchmark(name, param, 1.0, minTime, [&](long long repetitions) {
+        BenchClock::time_point start = BenchClock::now();
+        for (long long i = 0; i < repetitions; ++i, ++tick) {
+            world.step((tick / sweepTicks) % 2 == 0 ? left : right, deltaTime);
+            if (world.isFinished()) {
+                world.reset(1 + games++);
+            }
+        }
+        double seconds = secondsSince(start);
+        benchSink = world.score;
+        return seconds;
+    });
+}
+
+// headless_tick: a normal one-centipede game at several tick rates, on one thread
+static BenchResult benchHeadlessTick(int tickRate, double minTime) {
+    return benchGameTicks("headless_tick", tickRate, tickRate, GameConfig(), nullptr, minTime);
+}
+
+// swarm_tick: games with many centipedes at the default tick rate, on the benchmark thread pool
+static BenchResult benchSwarmTick(int centipedeCount, double minTime) {
+    GameConfig config;
+    config.centipedeCount = centipedeCount;
+    return benchGameTicks("swarm_tick", centipedeCount, SIM_TICK_RATE, config, benchPool, minTime);
+}
+
+// stress_tick: the stress level with a number of spiders, on the benchmark thread pool
+static BenchResult benchStressTick(int spiderCount, double minTime) {
+    GameConfig config = stressConfig;
+    config.spiderCount = spiderCount;
+    return benchGameTicks("stress_tick", spiderCount, SIM_TICK_RATE, config, benchPool, minTime);
+}
+
+/*
+A world with 64 centipedes, a number of spiders and many lasers scattered over the screen, stepped once. This covers
+the whole laser pass, broadphase included. The world is restored before every repetition, outside the timed region.
+- Input: name of the result, laserCount in flight, spiderCount of the world.
+*/
+static BenchResult benchLaserTick(const char* name, int laserCount, int spiderCount, double minTime) {
+    GameWorld initial;
+    initial.setThreadPool(benchPool);
+    initial.config.centipedeCount = 64;
+    initial.config.spiderCount = spiderCount;
+    initial.reset(1);
+    initial.lasers = LaserPool(laserCount);
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> xDist(0.f, SCREEN_WIDTH);
+    std::uniform_real_distribution<float> yDist(0.f, SCREEN_HEIGHT);
+    for (int i = 0; i < laserCount; ++i) {
+        initial.lasers.spawn(initial.sizes.laser, xDist(gen), yDist(gen));
+    }
+
+    GameWorld world = initial;
+    InputState input;
+    float deltaTime = 1.f / SIM_TICK_RATE;
+    return runBenchmark(name, laserCount, laserCount, minTime, [&](long long repetitions) {
+        double seconds = 0.0;
+        for (long long i = 0; i < repetitions; ++i) {
+            world = initial;
+            BenchClock::time_point start = BenchClock::now();
+            world.step(input, deltaTime);
+            seconds += secondsSince(start);
+        }
+        benchSink = world.score;
+        return seconds;
+    });
+}
+
+// laser_world: lasers over 64 centipedes and the one spider of the classic level
+static BenchResult benchLaserWorld(int laserCount, double minTime) {
+    return benchLaserTick("laser_world", laserCount, 1, minTime);
+}
+
+// laser_spiders: lasers over 64 centipedes and the 64 spiders of the stress level
+static BenchResult benchLaserSpiders(int laserCount, double minTime) {
+    return benchLaserTick("laser_spiders", laserCount, 64, minTime);
+}
+
+/*
+Plays a game with many centipedes for a second so the snapshot holds split centipedes, lasers in flight and damaged
+mushrooms, as a snapshot taken during play would.
+- Input: world to play, centipedeCount of its game.
+*/
+static void playSnapshotGame(GameWorld& world, int centipedeCount) {
+    world.config.centipedeCount = centipedeCount;
+    world.reset(1);
+    InputState input;
+    input.left = input.fire = true;
+    for (int tick = 0; tick < SIM_TICK_RATE && !world.isFinished(); ++tick) {
+        world.step(input, 1.f / SIM_TICK_RATE);
+    }
+}
+
+// snapshot_capture: writing the complete world into a reused snapshot buffer
+static BenchResult benchSnapshotCapture(int centipedeCount, double minTime) {
+    GameWorld world;
+    playSnapshotGame(world, centipedeCount);
+    GameSnapshot snapshot;
+    return runBenchmark("snapshot_capture", centipedeCount, 1.0, minTime, [&](long long repetitions) {
+        BenchClock::time_point start = BenchClock::now();
+        for (long long i = 0; i < repetitions; ++i) {
+            snapshot.capture(world);
+        }
+        double seconds = secondsSince(start);
+        benchSink = static_cast<long long>(snapshot.getSize());
+        return seconds;
+    });
+}
+
+// snapshot_restore: putting a world back into a captured state, as a rollback does
+static BenchResult benchSnapshotRestore(int centipedeCount, double minTime) {
+    GameWorld world;
+    playSnapshotGame(world, centipedeCount);
+    GameSnapshot snapshot;
+    snapshot.capture(world);
+    return runBenchmark("snapshot_restore", centipedeCount, 1.0, minTime, [&](long long repetitions) {
+        bool restored = true;
+        BenchClock::time_point start = BenchClock::now();
+        for (long long i = 0; i < repetitions; ++i) {
+            restored = snapshot.restore(world) && restored;
+        }
+        double seconds = secondsSince(start);
+        benchSink = restored ? world.score : -1;
+        return seconds;
+    });
+}
+
+/*
+Writes the results as a JSON document.
+- Input: file to write to, results of the run, minTime used.
+*/
+static void writeJson(FILE* file, const std::vector<BenchResult>& results, double minTime, int threads) {
+    std::fprintf(file, "{\n  \"min_time\": %g,\n  \"samples\": %d,\n  \"threads\": %d,\n  \"benchmarks\": [\n",
+                 minTime, SAMPLES, threads);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        std::fprintf(file,
+                     "    {\"name\": \"%s\", \"param\": %lld, \"repetitions\": %lld, \"ops_per_repetition\": %g, "
+                     "\"median_ns_per_op\": %.4f, \"min_ns_per_op\": %.4f, \"ops_per_sec\": %.1f}%s\n",
+                     r.name.c_str(), r.param, r.repetitions, r.opsPerRepetition, r.medianNsPerOp, r.minNsPerOp,
+                     r.medianNsPerOp > 0.0 ? 1e9 / r.medianNsPerOp : 0.0, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+}
+
+int main(int argc, char* argv[]) {
+    std::string filter;
+    std::string outPath;
+    double minTime = 0.25;
+    int threads = 1;
+    std::string stressLevelPath = CENTIPEDE_STRESS_LEVEL;
+
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue) {
+            minTime = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            threads = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--out") == 0 && hasValue) {
+            outPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--stress-level") == 0 && hasValue) {
+            stressLevelPath = argv[++i];
+        } else {
+            std::fprintf(stderr, "Usage: %s [--filter TEXT] [--min-time SECONDS] [--threads N] [--out FILE]"
+                         " [--stress-level FILE]\n", argv[0]);
+            return -1;
+        }
+    }
+
+    std::string error;
+    bool runsStress = filter.empty() || std::strstr("stress_tick", filter.c_str()) != nullptr;
+    if (runsStress && !stressConfig.load(stressLevelPath, error)) {
+        std::fprintf(stderr, "Could not load level: %s\n", error.c_str());
+        return -1;
+    }
+
+    // Every benchmark with the scales it runs at
+    struct Suite {
+        const char* name;
+        std::vector<int> params;
+        BenchResult (*run)(int, double);
+    };
+    const Suite suites[] = {
+        {"centipede_update", {1, 10, 100, 1000, 10000}, benchCentipedeUpdate},
+        {"mushroom_query", {30, 1000, 10000, 100000}, benchMushroomQuery},
+        {"laser_centipede", {1, 10, 100, 1000}, benchLaserCentipede},
+        {"headless_tick", {30, 120, 480}, benchHeadlessTick},
+        {"swarm_tick", {16, 128, 512}, benchSwarmTick},
+        {"stress_tick", {1, 16, 64}, benchStressTick},
+        {"laser_world", {4, 16, 64, 256, 1024}, benchLaserWorld},
+        {"laser_spiders", {4, 16, 64, 256, 1024}, benchLaserSpiders},
+        {"snapshot_capture", {1, 64, 512}, benchSnapshotCapture},
+        {"snapshot_restore", {1, 64, 512}, benchSnapshotRestore},
+    };
+
+    ThreadPool pool(threads);
+    benchPool = &pool;
+
+    std::vector<BenchResult> results;
+    std::fprintf(stderr, "%-20s %10s %16s %16s\n", "benchmark", "param", "median ns/op", "min ns/op");
+    for (const Suite& suite : suites) {
+        if (!filter.empty() && std::strstr(suite.name, filter.c_str()) == nullptr) {
+            continue;
+        }
+        for (int param : suite.params) {
+            BenchResult result = suite.run(param, minTime);
+            std::fprintf(stderr, "%-20s %10lld %16.3f %16.3f\n", result.name.c_str(), result.param,
+                         result.medianNsPerOp, result.minNsPerOp);
+            results.push_back(result);
+        }
+    }
+
+    FILE* out = stdout;
+    if (!outPath.empty()) {
+        out = std::fopen(outPath.c_str(), "w");
+        if (!out) {
+            std::fprintf(stderr, "Could not write %s\n", outPath.c_str());
+            return -1;
+        }
+    }
+    writeJson(out, results, minTime, threads);
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
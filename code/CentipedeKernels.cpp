@@ -0,0 +1,79 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+SSE/AVX implementation of the centipede follow step with a scalar fallback. The instruction set is picked at compile
+time from the target flags (__AVX__, __SSE2__). Every path uses an exact sqrt and division rather than the approximate
+reciprocal instructions, so the paths agree with each other and with the scalar loop.
+*/
+
+#include "CentipedeKernels.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/*
+The loop runs from the tail towards the head. A block of segments [base, base + width) reads the block shifted by
+one towards the head, which has not been written yet, so updating in place still sees the positions from before
+the call. A move is cut short at the segment in front, which only matters when a tick is longer than the spacing.
+*/
+void followSegments(float* x, float* y, size_t count, float threshold, float step) {
+    size_t end = count; // Segments [1, end) are still to be processed
+
+#if defined(__AVX__)
+    const __m256 stepV = _mm256_set1_ps(step);
+    const __m256 thresholdV = _mm256_set1_ps(threshold);
+    const __m256 zero = _mm256_setzero_ps();
+    while (end >= 9) {
+        size_t base = end - 8;
+        __m256 cx = _mm256_loadu_ps(x + base);
+        __m256 cy = _mm256_loadu_ps(y + base);
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x + base - 1), cx);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y + base - 1), cy);
+        __m256 dist = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+        __m256 move = _mm256_and_ps(_mm256_cmp_ps(dist, thresholdV, _CMP_GT_OQ), _mm256_cmp_ps(dist, zero, _CMP_GT_OQ));
+        __m256 scale = _mm256_and_ps(move, _mm256_div_ps(_mm256_min_ps(stepV, dist), dist));
+        _mm256_storeu_ps(x + base, _mm256_add_ps(cx, _mm256_mul_ps(dx, scale)));
+        _mm256_storeu_ps(y + base, _mm256_add_ps(cy, _mm256_mul_ps(dy, scale)));
+        end = base;
+    }
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+    const __m128 stepS = _mm_set1_ps(step);
+    const __m128 thresholdS = _mm_set1_ps(threshold);
+    const __m128 zeroS = _mm_setzero_ps();
+    while (end >= 5) {
+        size_t base = end - 4;
+        __m128 cx = _mm_loadu_ps(x + base);
+        __m128 cy = _mm_loadu_ps(y + base);
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + base - 1), cx);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + base - 1), cy);
+        __m128 dist = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        __m128 move = _mm_and_ps(_mm_cmpgt_ps(dist, thresholdS), _mm_cmpgt_ps(dist, zeroS));
+        __m128 scale = _mm_and_ps(move, _mm_div_ps(_mm_min_ps(stepS, dist), dist));
+        _mm_storeu_ps(x + base, _mm_add_ps(cx, _mm_mul_ps(dx, scale)));
+        _mm_storeu_ps(y + base, _mm_add_ps(cy, _mm_mul_ps(dy, scale)));
+        end = base;
+    }
+#endif
+
+    // Scalar loop for the segments left over, or for all of them without SIMD
+    while (end >= 2) {
+        size_t i = end - 1;
+        float dx = x[i - 1] - x[i];
+        float dy = y[i - 1] - y[i];
+        float dist = std::sqrt(dx * dx + dy * dy);
+        if (dist > threshold && dist > 0.f) {
+            float scale = std::min(step, dist) / dist;
+            x[i] += dx * scale;
+            y[i] += dy * scale;
+        }
+        end = i;
+    }
+}
@@ -0,0 +1,23 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Data-parallel kernels over packed centipede segment positions. The segment x and y coordinates are stored in separate
+float arrays so these loops can run on SSE or AVX registers; a scalar loop handles what is left over and is used
+alone on targets without SIMD.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+/*
+Moves every body segment towards the segment in front of it. Segment i moves by step along the direction to segment
+i-1 when it is farther than threshold away, but never past it: a segment closer than step stops where segment i-1
+was. All segments compare against the positions from before the call, so the segments are independent and can be
+processed in parallel.
+- Input: x and y are the packed coordinates of count segments, segment 0 (the head) is not moved.
+*/
+void followSegments(float* x, float* y, size_t count, float threshold, float step);
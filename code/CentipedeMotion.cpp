@@ -1,719 +1,629 @@
-/*
-Author: Rahil Vasa
-Class: ECE4122 
-Last Date Modified: 09/29/2024
-
-Description:
-This file implements a game where the player controls a spaceship to shoot centipedes, spiders, and destroy mushrooms while avoiding collisions.
-*/
-
-#include <SFML/Graphics.hpp>
-#include <cmath>
-#include <vector>
-#include <list>
-#include <random>
-#include <sstream>  
-
-// Global constants for screen dimensions and settings
-const int SCREEN_WIDTH = 1036;
-const int SCREEN_HEIGHT = 569;
-const int Y_DISPLACEMENT = 25;    // Vertical displacement when moving down or up
-const float SHIP_SPEED = 300.f;   // Speed of the spaceship
-const float LASER_SPEED = 600.f;  // Speed of the laser blast
-const float SHOT_INTERVAL = 0.6f; // Interval between laser shots in seconds
-const float CENTIPEDE_SPEED = 450.f; // Speed of the centipede
-const float SPIDER_SPEED = 200.f;  // Speed of the spider
-const int TOP_BUFFER = 50;        // Top buffer area without mushrooms
-const int BOTTOM_BUFFER = 100;    // Bottom buffer area without mushrooms
-
-// respawn clock for the spider
-sf::Clock spiderRespawnClock;
-
-// Declaration of the normalize function
-sf::Vector2f normalize(sf::Vector2f v);
-
-// Function to calculate the distance between two points
-float distance(sf::Vector2f a, sf::Vector2f b) {
-    return std::sqrt((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y));
-}
-
-// Function to normalize a vector
-sf::Vector2f normalize(sf::Vector2f v) {
-    float mag = std::sqrt(v.x * v.x + v.y * v.y);
-    if (mag == 0) return sf::Vector2f(0, 0);
-    return sf::Vector2f(v.x / mag, v.y / mag);
-}
-
-/*
-The Mushroom struct represents a mushroom in the game. 
-It stores information like its sprite, position on the screen, 
-and whether it is small or not. 
-*/
-struct Mushroom {
-    sf::Sprite sprite;
-    sf::Vector2f position;
-    bool isSmall;
-
-    Mushroom(sf::Texture& texture, float x, float y, bool small = false)
-        : isSmall(small) {
-        sprite.setTexture(texture);
-        sprite.setPosition(x, y);
-        position = {x, y};
-    }
-};
-
-/*
-The EceCentipede class represents the centipede enemy in the game. 
-It can move across the screen, change direction when it hits the boundary or a mushroom, 
-and can split into multiple centipedes when hit by a laser. This class handles all movement and collision logic for the centipede.
-*/
-class ECE_Centipede : public sf::Sprite {
-public:
-    /*
-    This is the constructor for the centipede. It initializes the head of the centipede and then adds several body segments behind it. The
-    inputs are the textures for the head and body of the centipede, the number of segments to create, and the starting position of the Centipede. 
-    */
-    ECE_Centipede(sf::Texture& headTexture, sf::Texture& bodyTexture, int numSegments, sf::Vector2f startPosition = {0.f, 0.f})
-        : headTexture(headTexture), bodyTexture(bodyTexture), followDistance(30.f), direction(1.f, 0.f), moveDirectionDown(true),
-          leftBound(0.f), rightBound(SCREEN_WIDTH), lowerBound(SCREEN_HEIGHT) {
-
-        // Initialize the head
-        sf::Sprite head(headTexture);
-        head.setPosition(startPosition);
-        segments.push_back(head);
-
-        // Initialize and create the body segments behind the head. 
-        for (int i = 1; i < numSegments; ++i) {
-            sf::Sprite body(bodyTexture);
-            body.setPosition(startPosition.x, startPosition.y + i * followDistance);
-            segments.push_back(body);
-        }
-    }
-    /*
-    The update function is called every frame to move the centipede across the screen. 
-    It handles moving the head of the centipede based on its direction and then makes sure each body segment follows the one before it.
-    It also ensures the centipede changes direction when it reaches the boundary of the screen. This function takes deltaTime as input, 
-    which controls the speed of movement based on the time since the last update.
-    */
-    void update(float deltaTime) {
-        // Move the head based on the current direction
-        segments[0].move(direction * CENTIPEDE_SPEED * deltaTime);
-
-        // Check for collisions with screen boundaries
-        checkBounds();
-
-        // Update the rest of the segments to follow the head
-        for (int i = 1; i < segments.size(); ++i) {
-            sf::Vector2f dir = segments[i - 1].getPosition() - segments[i].getPosition();
-            float dist = distance(segments[i - 1].getPosition(), segments[i].getPosition());
-
-            if (dist > followDistance) {
-                segments[i].move(normalize(dir) * (CENTIPEDE_SPEED * deltaTime));
-            }
-        }
-    }
-
-    /*
-    The draw function draws each segment of the centipede on it. 
-    This is called each frame to ensure the centipede appears on the screen.
-    */
-    void draw(sf::RenderWindow& window) {
-        // Draw all segments
-        for (auto& segment : segments) {
-            window.draw(segment);
-        }
-    }
-
-    /*
-    This function checks if the head of the centipede has collided with a mushroom.
-    If a collision is detected, the centipede changes direction to simulate it hitting an obstacle.
-    This function takes a list of mushrooms to check for collisions.
-    */
-    void checkMushroomCollision(std::list<Mushroom>& mushrooms) {
-        for (auto& mushroom : mushrooms) {
-            if (segments[0].getGlobalBounds().intersects(mushroom.sprite.getGlobalBounds())) {
-                // Change direction when the head collides with a mushroom
-                direction = sf::Vector2f(-direction.x, direction.y);
-                moveVertically(segments[0].getPosition());
-                break;
-            }
-        }
-    }
-
-
-    /*
-    This function checks if the centipede has been hit by a laser shot.
-    If it gets hit, it either removes the head, splits the centipede into two, or simply removes the body segment that got hit.
-    The score is updated accordingly. If the centipede is completely destroyed, it returns true. Inputs are laserBounds for checking 
-    collision, list of centipedes, score for updating the player's points. Returns true if the centipede is fully destroyed, false otherwise.
-    */
-    bool checkLaserCollision(const sf::FloatRect& laserBounds, std::list<ECE_Centipede>& centipedes, int& score) {
-        for (int i = 0; i < segments.size(); ++i) {
-            if (segments[i].getGlobalBounds().intersects(laserBounds)) {
-                if (i == 0) {
-                    // If the head is hit, remove it and make the next segment the new head
-                    segments.erase(segments.begin());
-                    score += 100; // Increment score by 100 for hitting the head
-                } else if (i == segments.size() - 1) {
-                    // If the tail is hit, just remove it
-                    segments.pop_back();
-                    score += 10; // Increment score by 10 for hitting a body segment
-                } else {
-                    // If a body segment is hit, split the centipede into two
-                    std::vector<sf::Sprite> newSegments1(segments.begin(), segments.begin() + i);
-                    std::vector<sf::Sprite> newSegments2(segments.begin() + i + 1, segments.end());
-
-                    if (!newSegments1.empty()) {
-                        newSegments1[0].setTexture(headTexture);
-                        centipedes.emplace_back(headTexture, bodyTexture, newSegments1.size());
-                        centipedes.back().segments = newSegments1;
-                        centipedes.back().direction = direction; // Keep same direction for first half
-                    }
-
-                    if (!newSegments2.empty()) {
-                        newSegments2[0].setTexture(headTexture);
-                        centipedes.emplace_back(headTexture, bodyTexture, newSegments2.size());
-                        centipedes.back().segments = newSegments2;
-                        centipedes.back().direction = -direction; // Reverse direction for the second half
-                    }
-
-                    score += 10; // Increment score by 10 for hitting a body segment
-
-                    // Remove the original centipede as it has been split
-                    return true;
-                }
-                return segments.empty(); // Return true if centipede is fully destroyed
-            }
-        }
-        return false;
-    }
-
-    /*
-    This function checks if the centipede collides with the spaceship.
-    If a collision occurs, it returns true, which is used to handle the player's lives.
-    - Input: spaceshipBounds, which defines the area occupied by the spaceship.
-    - Output: Returns true if there is a collision, false otherwise.
-    */
-    bool checkSpaceshipCollision(const sf::FloatRect& spaceshipBounds) {
-        for (auto& segment : segments) {
-            if (segment.getGlobalBounds().intersects(spaceshipBounds)) {
-                return true; // Collision detected
-            }
-        }
-        return false;
-    }
-
-    std::vector<sf::Sprite> segments;
-
-private:
-    sf::Texture& headTexture;
-    sf::Texture& bodyTexture;
-    float followDistance;              // Distance each segment tries to maintain from the one in front
-    sf::Vector2f direction;            // Current direction of movement
-    bool moveDirectionDown;            // True if moving down, false if moving up
-    const float leftBound;             // Left boundary for movement
-    const float rightBound;            // Right boundary for movement
-    const float lowerBound;            // Lower boundary for movement
-
-    /*
-    This function moves the head vertically, either up or down, based on the current direction.
-    It is used when the centipede changes direction after hitting an obstacle or boundary.
-    - Input: headPosition, which is the current position of the head segment.
-    */
-    void moveVertically(sf::Vector2f headPosition) {
-        if (moveDirectionDown) {
-            segments[0].setPosition(headPosition.x, headPosition.y + Y_DISPLACEMENT);
-        } else {
-            segments[0].setPosition(headPosition.x, headPosition.y - Y_DISPLACEMENT);
-        }
-
-        if (headPosition.y <= 0) {
-            moveDirectionDown = false;
-        }
-
-        if ((headPosition.y + 27) >= lowerBound) {
-            moveDirectionDown = true;
-        }
-    }
-
-    /*
-    This function checks if the centipede head has reached the boundaries of the screen.
-    If it does, it changes the movement direction accordingly.
-    */
-    void checkBounds() {
-        sf::Vector2f headPosition = segments[0].getPosition();
-        if (headPosition.x <= leftBound) {
-            direction = sf::Vector2f(1.f, 0.f);
-            moveVertically(headPosition);
-        } else if ((headPosition.x + 27) >= rightBound) {
-            direction = sf::Vector2f(-1.f, 0.f);
-            moveVertically(headPosition);
-        }
-
-        if (headPosition.y <= 0) {
-            moveDirectionDown = true;
-        } else if ((headPosition.y + Y_DISPLACEMENT + 27) > lowerBound) {
-            moveDirectionDown = false;
-        }
-    }
-};
-
-// Laser class for firing laser shots from spaceship
-class ECE_LaserBlast : public sf::Sprite {
-public:
-    // - Input: laserTexture for the visual representation, and x and y for the starting position.
-    ECE_LaserBlast(sf::Texture& laserTexture, float x, float y) {
-        this->setTexture(laserTexture);
-        this->setPosition(x, y);
-    }
-
-    // - Input: deltaTime controls how much the laser moves based on elapsed time.
-    void update(float deltaTime) {
-        // Move the laser upwards
-        this->move(0, -LASER_SPEED * deltaTime);
-    }
-
-    /*
-    Checks if the laser has moved off the top of the screen.
-    - Output: Returns true if the laser is off-screen, false otherwise.
-    */
-    bool isOffScreen() {
-        // Check if the laser has moved off the top of the screen
-        return this->getPosition().y < 0;
-    }
-};
-
-// Spider class for randomly moving spider
-class Spider : public sf::Sprite {
-public:
-    /*
-    Represents a spider in the game. It moves in a random direction on the screen 
-    and can collide with mushrooms, the player's spaceship, or get shot by a laser.
-    - Input: spiderTexture: The texture for the spider.
-    */
-    Spider(sf::Texture& spiderTexture) {
-        this->setTexture(spiderTexture);
-        this->setPosition(static_cast<float>(rand() % SCREEN_WIDTH), static_cast<float>(rand() % SCREEN_HEIGHT / 2));
-        direction = sf::Vector2f((rand() % 2 ? 1.f : -1.f), (rand() % 2 ? 1.f : -1.f));
-        isAlive = true;
-    }
-
-    /*
-    Update the spider's position based on the direction it is moving.
-    Changes direction if it hits the boundaries of the screen.
-    - Input: deltaTime controls how much the spider moves based on the time passed since the last update.
-    */
-    void update(float deltaTime) {
-        if (isAlive) {
-            this->move(direction * SPIDER_SPEED * deltaTime);
-
-            // Change direction if hitting boundaries
-            sf::Vector2f position = this->getPosition();
-            if (position.x <= 0 || position.x + this->getGlobalBounds().width >= SCREEN_WIDTH) {
-                direction.x = -direction.x;
-            }
-            if (position.y <= 0 || position.y + this->getGlobalBounds().height >= SCREEN_HEIGHT) {
-                direction.y = -direction.y;
-            }
-        }
-    }
-
-    /*
-    Checks if the spider has collided with a mushroom. 
-    If there is a collision, the mushroom is destroyed.
-    - Input: mushrooms is a list of mushrooms to check for collisions.
-    - Output: Returns true if a mushroom is destroyed.
-    */
-    bool checkMushroomCollision(std::list<Mushroom>& mushrooms) {
-        if (isAlive) {
-            for (auto mushroomIt = mushrooms.begin(); mushroomIt != mushrooms.end();) {
-                if (this->getGlobalBounds().intersects(mushroomIt->sprite.getGlobalBounds())) {
-                    mushroomIt = mushrooms.erase(mushroomIt);
-                    return true; // Destroy mushroom on collision
-                } else {
-                    ++mushroomIt;
-                }
-            }
-        }
-        return false;
-    }
-
-    /*
-    Check if the spider collides with the player's spaceship.
-    - Input: spaceshipBounds is the area covered by the spaceship.
-    - Output: Returns true if the spider collides with the spaceship, false otherwise.
-    */
-    bool checkSpaceshipCollision(const sf::FloatRect& spaceshipBounds) {
-        return isAlive && this->getGlobalBounds().intersects(spaceshipBounds);
-    }
-
-    /*
-    Check if the spider is hit by a laser.
-    If hit, the spider is set to not alive and the score is incremented.
-    - Input: laserBounds is the area covered by the laser, score is the player's score to be updated.
-    - Output: Returns true if the spider is hit by a laser.
-    */
-    bool checkLaserCollision(const sf::FloatRect& laserBounds, int& score) {
-        if (isAlive && this->getGlobalBounds().intersects(laserBounds)) {
-            isAlive = false;
-            spiderRespawnClock.restart();
-            score += 300; // Increment score by 300 when hitting the spider
-            return true;
-        }
-        return false;
-    }
-
-    /*
-    Set the alive state of the spider.
-    - Input: alive, which is either true (alive) or false (not alive).
-    */
-    void setIsAlive(bool alive) {
-        isAlive = alive;
-    }
-    
-    /*
-    Get the current alive state of the spider.
-    - Output: Returns true if the spider is alive, false otherwise.
-    */
-    bool getIsAlive() const {
-        return isAlive;
-    }
-
-private:
-    sf::Vector2f direction; // Direction of movement
-    bool isAlive;           // State of the spider
-};
-
-int main() {
-    // Window setup
-    sf::RenderWindow window(sf::VideoMode(SCREEN_WIDTH, SCREEN_HEIGHT), "Smooth Centipede Movement");
-
-    // Load textures for centipede head, body, mushrooms, spaceship, laser, spider, and startup screen
-    sf::Texture centipedeHeadTexture;
-    sf::Texture centipedeBodyTexture;
-    sf::Texture mushroomTexture;
-    sf::Texture mushroomSmallTexture;
-    sf::Texture starshipTexture;
-    sf::Texture laserTexture;
-    sf::Texture spiderTexture;
-    sf::Texture startScreenTexture;
-
-    if (!centipedeHeadTexture.loadFromFile("graphics/CentipedeHead.png") ||
-        !centipedeBodyTexture.loadFromFile("graphics/CentipedeBody.png") ||
-        !mushroomTexture.loadFromFile("graphics/Mushroom0.png") ||
-        !mushroomSmallTexture.loadFromFile("graphics/Mushroom1.png") ||
-        !starshipTexture.loadFromFile("graphics/StarShip.png") ||
-        !laserTexture.loadFromFile("graphics/LaserClass.png") ||
-        !spiderTexture.loadFromFile("graphics/spider.png") ||
-        !startScreenTexture.loadFromFile("graphics/Startup Screen BackGround.png")) {
-        return -1;
-    }
-
-    // Create start screen sprite
-    sf::Sprite startScreenSprite;
-    startScreenSprite.setTexture(startScreenTexture);
-
-    // Wait for the user to press Enter to start the game
-    bool startGame = false;
-    while (window.isOpen() && !startGame) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed)
-                window.close();
-
-            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Enter) {
-                startGame = true;
-            }
-        }
-
-        window.clear();
-        window.draw(startScreenSprite);
-        window.display();
-    }
-
-    // Create the centipede list
-    std::list<ECE_Centipede> centipedes;
-    centipedes.emplace_back(centipedeHeadTexture, centipedeBodyTexture, 12);
-
-    // Create a list of mushrooms using a random generator
-    std::list<Mushroom> mushrooms;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> xDist(0, SCREEN_WIDTH - 100);
-    std::uniform_int_distribution<> yDist(TOP_BUFFER, SCREEN_HEIGHT - BOTTOM_BUFFER);
-
-    for (int i = 0; i < 30; ++i) {
-        float x = static_cast<float>(xDist(gen));
-        float y = static_cast<float>(yDist(gen));
-        mushrooms.emplace_back(mushroomTexture, x, y);
-    }
-
-    // Create the spaceship sprite
-    sf::Sprite spaceship;
-    spaceship.setTexture(starshipTexture);
-    sf::Vector2f initialPosition(SCREEN_WIDTH / 2.f, SCREEN_HEIGHT - BOTTOM_BUFFER + 20.f);
-    spaceship.setPosition(initialPosition); // Initial position for the spaceship
-
-    // Create lives (depicted as spaceship sprites)
-    int lives = 2;
-    std::vector<sf::Sprite> livesSprites;
-    for (int i = 0; i < lives; ++i) {
-        sf::Sprite lifeSprite;
-        lifeSprite.setTexture(starshipTexture);
-        lifeSprite.setPosition(SCREEN_WIDTH - (i + 1) * 50.f - 10.f, 10.f);
-        livesSprites.push_back(lifeSprite);
-    }
-
-    // Create the spider
-    Spider spider(spiderTexture);
-
-    // Create a list of laser shots
-    std::list<ECE_LaserBlast> lasers;
-    sf::Clock laserClock;
-
-    sf::Clock clock;
-
-    // Score variable
-    int score = 0;
-
-    // Font setup for score display
-    sf::Font font;
-    if (!font.loadFromFile("fonts/KOMIKAP.ttf")) {
-        return -1; // Ensure that the font file is available in the specified directory
-    }
-
-    sf::Text scoreText;
-    scoreText.setFont(font);
-    scoreText.setCharacterSize(24);
-    scoreText.setFillColor(sf::Color::White);
-    scoreText.setPosition(10.f, 10.f);
-
-    // Game Over text
-    sf::Text gameOverText;
-    gameOverText.setFont(font);
-    gameOverText.setCharacterSize(72);
-    gameOverText.setFillColor(sf::Color::Red); // Red font for the Game Over text. 
-    gameOverText.setString("GAME OVER");
-    gameOverText.setPosition(SCREEN_WIDTH / 2.f - 200.f, SCREEN_HEIGHT / 2.f - 50.f);
-
-    // You Win text
-    sf::Text youWinText;
-    youWinText.setFont(font);
-    youWinText.setCharacterSize(72);
-    youWinText.setFillColor(sf::Color::Green); // Green font for the You Win text. 
-    youWinText.setString("YOU WIN");
-    youWinText.setPosition(SCREEN_WIDTH / 2.f - 150.f, SCREEN_HEIGHT / 2.f - 50.f);
-
-    bool gameOver = false;
-    bool youWin = false;
-
-    // Main loop
-    while (window.isOpen()) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed)
-                window.close();
-        }
-
-        // Time delta for smooth movement
-        float deltaTime = clock.restart().asSeconds();
-
-        if (!gameOver && !youWin) {
-            // Update centipedes
-            for (auto it = centipedes.begin(); it != centipedes.end();) {
-                it->update(deltaTime);
-                if (it->segments.empty()) {
-                    it = centipedes.erase(it);
-                } else {
-                    ++it;
-                }
-            }
-
-            // Check if all centipedes are destroyed (player wins)
-            if (centipedes.empty()) {
-                youWin = true;
-            }
-
-            // Check for collisions between centipedes and mushrooms
-            for (auto& centipede : centipedes) {
-                centipede.checkMushroomCollision(mushrooms);
-            }
-
-            // Update the spider
-            if (!spider.getIsAlive() && spiderRespawnClock.getElapsedTime().asSeconds() >= 5.f) { // We want the spider to respawn 5 seconds after its dead. 
-                spider.setIsAlive(true);
-            }
-            spider.update(deltaTime);
-            spider.checkMushroomCollision(mushrooms);
-
-            // Move the spaceship with arrow keys
-            sf::Vector2f spaceshipPosition = spaceship.getPosition();
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up) && spaceshipPosition.y > SCREEN_HEIGHT - BOTTOM_BUFFER) {
-                spaceship.move(0.f, -SHIP_SPEED * deltaTime); // SHIP_SPEED give you control of how fast you want the ship. 
-            }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down) && spaceshipPosition.y < SCREEN_HEIGHT - starshipTexture.getSize().y) {
-                spaceship.move(0.f, SHIP_SPEED * deltaTime);
-            }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left) && spaceshipPosition.x > 0) {
-                spaceship.move(-SHIP_SPEED * deltaTime, 0.f);
-            }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right) && spaceshipPosition.x < SCREEN_WIDTH - starshipTexture.getSize().x) {
-                spaceship.move(SHIP_SPEED * deltaTime, 0.f);
-            }
-
-            // Shooting lasers with spacebar
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space) && laserClock.getElapsedTime().asSeconds() > SHOT_INTERVAL) {
-                float laserX = spaceshipPosition.x + starshipTexture.getSize().x / 2.f - laserTexture.getSize().x / 2.f;
-                float laserY = spaceshipPosition.y;
-                lasers.emplace_back(laserTexture, laserX, laserY);
-                laserClock.restart();
-            }
-
-            // Update lasers and remove those that go off screen
-            for (auto it = lasers.begin(); it != lasers.end();) {
-                it->update(deltaTime);
-                if (it->isOffScreen()) {
-                    it = lasers.erase(it);
-                } else {
-                    ++it;
-                }
-            }
-
-            // Check for laser collisions with mushrooms
-            for (auto laserIt = lasers.begin(); laserIt != lasers.end();) {
-                bool laserHit = false;
-
-                for (auto mushroomIt = mushrooms.begin(); mushroomIt != mushrooms.end(); ++mushroomIt) {
-                    if (laserIt->getGlobalBounds().intersects(mushroomIt->sprite.getGlobalBounds())) {
-                        laserHit = true;
-
-                        if (!mushroomIt->isSmall) {
-                            // Change mushroom to smaller one on first hit
-                            mushroomIt->sprite.setTexture(mushroomSmallTexture);
-                            mushroomIt->isSmall = true;
-                        } else {
-                            // Remove mushroom from list on second hit
-                            mushroomIt = mushrooms.erase(mushroomIt);
-                            score += 4;  // Increment score by 4 only when the mushroom is fully destroyed
-                        }
-
-                        break; // Laser can only hit one mushroom, so break after collision
-                    }
-                }
-
-                if (laserHit) {
-                    laserIt = lasers.erase(laserIt); // Remove laser after hit
-                } else {
-                    ++laserIt;
-                }
-            }
-
-            // Check for laser collisions with centipedes
-            for (auto laserIt = lasers.begin(); laserIt != lasers.end();) {
-                bool laserHit = false;
-
-                for (auto centipedeIt = centipedes.begin(); centipedeIt != centipedes.end();) {
-                    if (centipedeIt->checkLaserCollision(laserIt->getGlobalBounds(), centipedes, score)) {
-                        centipedeIt = centipedes.erase(centipedeIt);
-                        laserHit = true;
-                        break;
-                    } else {
-                        ++centipedeIt;
-                    }
-                }
-
-                if (laserHit) {
-                    laserIt = lasers.erase(laserIt);
-                } else {
-                    ++laserIt;
-                }
-            }
-
-            // Check for laser collisions with spider
-            for (auto laserIt = lasers.begin(); laserIt != lasers.end();) {
-                if (spider.checkLaserCollision(laserIt->getGlobalBounds(), score)) {
-                    laserIt = lasers.erase(laserIt);
-                } else {
-                    ++laserIt;
-                }
-            }
-
-            // Check for collisions between centipedes and spaceship
-            for (auto& centipede : centipedes) {
-                if (centipede.checkSpaceshipCollision(spaceship.getGlobalBounds())) {
-                    lives--;
-                    livesSprites.pop_back();
-                    spaceship.setPosition(initialPosition); // Respawn spaceship to initial position
-                    if (lives == 0) {
-                        gameOver = true;
-                    }
-                    break; // Stop checking after a collision
-                }
-            }
-
-            // Check for collisions between spider and spaceship
-            if (spider.getIsAlive() && spider.checkSpaceshipCollision(spaceship.getGlobalBounds())) {
-                if (lives > 0) {
-                    lives--; // Decrease life count by 1
-                    livesSprites.pop_back(); // Remove one life icon from the screen
-                    spaceship.setPosition(initialPosition); // Respawn spaceship to initial position
-
-                    if (lives == 0) {
-                        gameOver = true; // Set game over only when all lives are lost
-                    }
-                }
-            }
-
-            // Update score display text
-            std::stringstream ss;
-            ss << "Score: " << score;
-            scoreText.setString(ss.str());
-        }
-
-        // Rendering
-        window.clear();
-
-        if (youWin) {
-            // Draw "YOU WIN" screen
-            window.draw(youWinText);
-        } else if (gameOver) {
-            // Draw game over screen
-            window.draw(gameOverText);
-        } else {
-            // Draw mushrooms
-            for (auto& mushroom : mushrooms) {
-                window.draw(mushroom.sprite);
-            }
-
-            // Draw centipedes
-            for (auto& centipede : centipedes) {
-                centipede.draw(window);
-            }
-
-            // Draw spaceship if not game over
-            window.draw(spaceship);
-
-            // Draw spider if alive
-            if (spider.getIsAlive()) {
-                window.draw(spider);
-            }
-
-            // Draw lasers
-            for (auto& laser : lasers) {
-                window.draw(laser);
-            }
-
-            // Draw score
-            window.draw(scoreText);
-
-            // Draw lives
-            for (auto& lifeSprite : livesSprites) {
-                window.draw(lifeSprite);
-            }
-        }
-
-        window.display();
-    }
-
-    return 0;
-}
+/*
+Author: Rahil Vasa
+Class: ECE4122 
+Last Date Modified: 10/16/2026
+
+Description:
+This file implements a game where the player controls a spaceship to shoot centipedes, spiders, and destroy mushrooms while avoiding collisions.
+The game rules live in GameWorld; this file owns the window, reads the keyboard and draws the world state every frame.
+The world is stepped at a fixed tick rate on a simulation thread of its own, independent of the display rate. After
+its ticks the simulation thread publishes a RenderSnapshot through a lock-free TripleBuffer, and the main thread draws
+the latest complete snapshot, interpolated between its last two ticks, so a slow display or vsync wait never holds up a
+tick and a heavy tick never holds up a frame.
+The controls are read as timestamped press and release events, also while the frame pacer waits, and each event is
+applied to the tick its timestamp falls in. A tap shorter than a tick or a frame still moves the ship or fires, and the
+input of a tick does not depend on the frame rate. The tick inputs are what --record saves.
+
+Press F3 to show the profiler overlay with the time spent in each phase of the frame.
+Press F5 to save the game to quicksave.csnp and F9 to go back to the last save, also after restarting the game.
+
+Usage: Lab1 [--sim-hz N] [--trace FILE] [--seed N] [--record FILE] [--pacing vsync|cap|uncapped] [--fps N]
+            [--level FILE]
+With --trace the timed phases of the whole session are written to FILE as a Chrome trace when the window closes.
+With --record the seed and the input of every tick are written to FILE when the game ends or the window closes; the
+game can then be replayed without a window with centipede_headless --replay FILE. --seed replaces the random seed of
+the level, to play a level from a bug report again.
+
+--level plays a level file (see GameConfig.h and levels/) instead of the classic level: other speeds and counts, more
+spiders, or an enlarged world such as levels/stress.level. The window keeps its size and the whole world is scaled to
+fit it; the score and lives stay at screen scale.
+
+--pacing chooses how the frame rate is held: vsync waits for the display, cap (the default) holds frames to --fps
+(default 60) with a short sleep and a final spin, and uncapped draws as fast as possible. Capping keeps the loop from
+using a whole core and gives evenly spaced frames without the queued frames of vsync. The start screen is always held
+to 30 frames per second. The input-to-display latency, from a control key event to the return of the display call
+of the first frame that shows its effect, is shown in the F3 overlay and printed when the window closes. The event
+time is when the loop polls it, so the time the event waited in the system queue is not included.
+
+Textures and the font are loaded from the asset bundle (assets.pak) that the build writes next to the binary. If it is
+missing or was built for another version, the loose files in graphics/ and fonts/ are loaded instead. The first level
+is generated, and the loose files decoded, on a loading thread while the start screen is shown.
+*/
+
+#include "AssetBundle.h"
+#include "FixedTimestep.h"
+#include "FramePacer.h"
+#include "GameSnapshot.h"
+#include "GameWorld.h"
+#include "InputQueue.h"
+#include "InputRecording.h"
+#include "LatencyMonitor.h"
+#include "MushroomLayer.h"
+#include "Profiler.h"
+#include "ProfilerOverlay.h"
+#include "RenderSnapshot.h"
+#include "SpriteBatch.h"
+#include "TextureAtlas.h"
+#include "TripleBuffer.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+const float START_SCREEN_FRAME_RATE = 30.f; // Redraw rate of the start screen
+const float DEFAULT_FRAME_RATE = 60.f;      // Frame rate of the capped pacing mode
+const char* const QUICKSAVE_PATH = "quicksave.csnp"; // Snapshot file written by F5 and read by F9
+
+// Everything the loading thread prepares while the start screen is shown
+struct LoadedGame {
+    bool loaded = false;                // False if an asset file is missing
+    sf::Image atlasImage;               // Atlas packed from the loose files; unused when the bundle was loaded
+    sf::IntRect rects[SPRITE_COUNT];    // Rectangle of every sprite in the atlas
+    std::vector<char> fontData;         // Font file contents; unused when the bundle was loaded
+    std::unique_ptr<GameWorld> world;   // World with its first level generated
+};
+
+// - Output: Returns the input bit of a key that steers the spaceship or fires, 0 for any other key.
+static uint8_t getControlKey(sf::Keyboard::Key key) {
+    switch (key) {
+    case sf::Keyboard::Up:
+        return KEY_UP;
+    case sf::Keyboard::Down:
+        return KEY_DOWN;
+    case sf::Keyboard::Left:
+        return KEY_LEFT;
+    case sf::Keyboard::Right:
+        return KEY_RIGHT;
+    case sf::Keyboard::Space:
+        return KEY_FIRE;
+    default:
+        return 0;
+    }
+}
+
+// - Output: Returns the size of a sprite rectangle in pixels.
+static Vec2f getRectSize(const sf::IntRect& rect) {
+    return Vec2f(static_cast<float>(rect.width), static_cast<float>(rect.height));
+}
+
+/*
+Runs on the loading thread: decodes and packs the images and reads the font if the bundle could not be used, then
+generates the world. Nothing here touches the window or the GPU.
+- Input: bundle if it was loaded, otherwise nullptr, seed and config of the first level.
+- Output: Returns the prepared game.
+*/
+static std::unique_ptr<LoadedGame> loadGame(const AssetBundle* bundle, unsigned int seed, GameConfig config) {
+    std::unique_ptr<LoadedGame> game(new LoadedGame());
+    if (bundle != nullptr) {
+        for (int i = 0; i < SPRITE_COUNT; ++i) {
+            game->rects[i] = bundle->getRect(static_cast<SpriteId>(i));
+        }
+    } else {
+        PROFILE_SCOPE("decode assets");
+        std::ifstream fontFile("fonts/KOMIKAP.ttf", std::ios::binary);
+        if (!packAtlasFiles("graphics/", game->atlasImage, game->rects) || !fontFile) {
+            return game;
+        }
+        game->fontData.assign(std::istreambuf_iterator<char>(fontFile), std::istreambuf_iterator<char>());
+    }
+
+    // Collision bounds follow the loaded images
+    EntitySizes sizes;
+    sizes.centipedeHead = getRectSize(game->rects[SPRITE_CENTIPEDE_HEAD]);
+    sizes.centipedeBody = getRectSize(game->rects[SPRITE_CENTIPEDE_BODY]);
+    sizes.mushroom = getRectSize(game->rects[SPRITE_MUSHROOM]);
+    sizes.spaceship = getRectSize(game->rects[SPRITE_SPACESHIP]);
+    sizes.laser = getRectSize(game->rects[SPRITE_LASER]);
+    sizes.spider = getRectSize(game->rects[SPRITE_SPIDER]);
+
+    {
+        PROFILE_SCOPE("generate world");
+        game->world.reset(new GameWorld(sizes, config));
+        game->world->reset(seed);
+    }
+    game->loaded = true;
+    return game;
+}
+
+// State shared by the window thread and the simulation thread. The window thread only pushes key events and sets the
+// requests; everything else belongs to the simulation thread until it has been joined.
+struct Simulation {
+    GameWorld* world = nullptr;
+    float tickRate = SIM_TICK_RATE;
+    unsigned int seed = 0;                  // Seed of a new level when a quick load fails
+    InputQueue inputQueue;                  // Guarded by inputMutex
+    std::mutex inputMutex;
+    std::atomic<bool> running{true};
+    std::atomic<bool> quickSaveRequested{false}; // F5 was pressed
+    std::atomic<bool> quickLoadRequested{false}; // F9 was pressed
+    TripleBuffer<RenderSnapshot> snapshots; // Render state published after every batch of ticks
+    GameSnapshot quicksave;                 // Quick save slot, kept in memory and on disk
+    InputRecording recording;               // Input log of the game, saved once when it ends or the window closes
+    std::string recordPath;
+    bool recordingGame = false;
+};
+
+// Ends the recording of the game and writes it to the --record file.
+static void endRecording(Simulation& simulation) {
+    simulation.recording.end(*simulation.world);
+    if (!simulation.recording.save(simulation.recordPath)) {
+        std::cerr << "Could not write recording " << simulation.recordPath << std::endl;
+    }
+    simulation.recordingGame = false;
+}
+
+/*
+Runs on the simulation thread until running is cleared: steps the world at the fixed tick rate with the input of the
+key events queued by the window thread, does the quick saves and loads it asks for, and publishes a render snapshot
+after every batch of ticks. It sleeps between ticks, so a slow frame on the window thread never delays a tick and a
+slow tick never delays a frame; the window thread draws the previous snapshot again instead. Unlike a frame, a tick
+has no display deadline, so the thread only sleeps until the next tick is due and never spins: a late wake-up just
+runs that tick a little later, and FixedTimestep catches up on any whole ticks it missed.
+- Input: simulation shared with the window thread.
+*/
+static void runSimulation(Simulation& simulation) {
+    GameWorld& world = *simulation.world;
+    FixedTimestep timestep(simulation.tickRate);
+    InputQueue::Clock::duration tickDuration =
+        std::chrono::duration_cast<InputQueue::Clock::duration>(std::chrono::duration<float>(timestep.getTickLength()));
+    InputQueue::Clock::time_point lastLoop = InputQueue::Clock::now();
+    InputQueue::Clock::time_point nextTick = lastLoop + tickDuration;
+    uint64_t inputTicks = 0;
+    if (simulation.recordingGame) {
+        simulation.recording.begin(simulation.seed, world.config, timestep.getTickLength());
+    }
+
+    while (simulation.running.load()) {
+        bool changed = false;
+        GameSnapshot& quicksave = simulation.quicksave;
+        if (simulation.quickSaveRequested.exchange(false)) {
+            quicksave.capture(world);
+            if (!quicksave.save(QUICKSAVE_PATH)) {
+                std::cerr << "Could not write " << QUICKSAVE_PATH << std::endl;
+            }
+        }
+        if (simulation.quickLoadRequested.exchange(false) && (!quicksave.isEmpty() || quicksave.load(QUICKSAVE_PATH))) {
+            // The recording only holds the inputs of one continuous game, so it ends here
+            if (simulation.recordingGame) {
+                endRecording(simulation);
+            }
+            if (!quicksave.restore(world)) {
+                std::cerr << "Could not restore " << QUICKSAVE_PATH << std::endl;
+                world.reset(simulation.seed);
+            }
+            changed = true;
+        }
+
+        // Real time since the last pass, turned into a whole number of fixed simulation ticks
+        InputQueue::Clock::time_point loopStart = InputQueue::Clock::now();
+        int ticks = timestep.advance(std::chrono::duration<float>(loopStart - lastLoop).count());
+        lastLoop = loopStart;
+
+        // The ticks of this pass end where the time still accumulated begins, one tick length apart
+        InputQueue::Clock::time_point lastTickEnd =
+            loopStart - std::chrono::duration_cast<InputQueue::Clock::duration>(
+                            std::chrono::duration<float>(timestep.getAccumulated()));
+
+        if (!world.isFinished()) {
+            PROFILE_SCOPE("simulation");
+            for (int tick = 0; tick < ticks && !world.isFinished(); ++tick) {
+                // Apply the key events that happened up to the end of this tick
+                bool consumed = false;
+                InputState input;
+                {
+                    std::lock_guard<std::mutex> lock(simulation.inputMutex);
+                    input = simulation.inputQueue.takeTick(lastTickEnd - (ticks - 1 - tick) * tickDuration, consumed);
+                }
+                if (simulation.recordingGame) {
+                    simulation.recording.record(input);
+                }
+                world.step(input, timestep.getTickLength());
+                if (consumed) {
+                    ++inputTicks;
+                }
+                changed = true;
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(simulation.inputMutex);
+            simulation.inputQueue.clear();
+        }
+
+        if (changed) {
+            PROFILE_SCOPE("publish snapshot");
+            RenderSnapshot& snapshot = simulation.snapshots.getWriteBuffer();
+            snapshot.capture(world);
+            snapshot.tickEnd = lastTickEnd;
+            snapshot.inputTicks = inputTicks;
+            simulation.snapshots.publish();
+        }
+
+        if (simulation.recordingGame && world.isFinished()) {
+            endRecording(simulation);
+        }
+
+        // Deadlines are one tick apart; a pass that ends past the next deadline runs the following pass right away,
+        // and FixedTimestep steps every tick that came due in the meantime
+        std::this_thread::sleep_until(nextTick);
+        nextTick = std::max(nextTick + tickDuration, InputQueue::Clock::now());
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Simulation rate, configurable from the command line
+    float simRate = SIM_TICK_RATE;
+    std::string tracePath;
+    std::string recordPath;
+    PacingMode pacingMode = PACING_CAPPED;
+    float frameRate = DEFAULT_FRAME_RATE;
+    GameConfig config;
+    std::random_device rd;
+    unsigned int seed = rd();
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--sim-hz") == 0) {
+            simRate = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--trace") == 0) {
+            tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--record") == 0) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--pacing") == 0) {
+            if (!FramePacer::parseMode(argv[++i], pacingMode)) {
+                std::cerr << "Unknown pacing mode " << argv[i] << ", use vsync, cap or uncapped" << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--fps") == 0) {
+            frameRate = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--level") == 0) {
+            std::string error;
+            if (!config.load(argv[++i], error)) {
+                std::cerr << "Could not load level: " << error << std::endl;
+                return 1;
+            }
+        }
+    }
+    if (simRate <= 0.f) {
+        simRate = SIM_TICK_RATE;
+    }
+    if (frameRate <= 0.f) {
+        frameRate = DEFAULT_FRAME_RATE;
+    }
+
+    // Window setup. The start screen never changes, so it is redrawn at a modest rate instead of as fast as possible.
+    sf::RenderWindow window(sf::VideoMode(SCREEN_WIDTH, SCREEN_HEIGHT), "Smooth Centipede Movement");
+    window.setVerticalSyncEnabled(pacingMode == PACING_VSYNC);
+    window.setKeyRepeatEnabled(false); // A held key sends one press, so only real input changes are measured
+    FramePacer startScreenPacer(PACING_CAPPED, START_SCREEN_FRAME_RATE);
+
+    // Frame profiler: the overlay is toggled with F3, the trace is captured from here, loading included, until the
+    // window closes
+    Profiler& profiler = Profiler::instance();
+    profiler.setEnabled(true);
+    if (!tracePath.empty()) {
+        profiler.startTrace(1 << 20);
+    }
+
+    // Load the centipede head, body, mushrooms, spaceship, laser, spider, and startup screen into one atlas texture,
+    // and the font for the score display. With the bundle this is one mapping and one upload, so the start screen is
+    // drawn from the atlas right away; the bundle stays mapped while the font reads from it. Without the bundle only
+    // the start screen image is loaded here and the loading thread decodes the rest.
+    AssetBundle bundle;
+    TextureAtlas atlas;
+    sf::Font font;
+    sf::Texture startScreenTexture;
+    sf::Sprite startScreenSprite;
+    bool bundleLoaded = bundle.open("assets.pak") && atlas.loadFromBundle(bundle) &&
+                        font.loadFromMemory(bundle.getFontData(), bundle.getFontSize());
+    if (bundleLoaded) {
+        startScreenSprite = sf::Sprite(atlas.getTexture(), atlas.getRect(SPRITE_START_SCREEN));
+    } else if (startScreenTexture.loadFromFile(std::string("graphics/") + getSpriteFileName(SPRITE_START_SCREEN))) {
+        startScreenSprite.setTexture(startScreenTexture, true);
+    } else {
+        return -1; // Ensure that the graphics files are available in the specified directory
+    }
+
+    // Decode the remaining assets and generate the first level on a loading thread while the start screen is shown
+    std::future<std::unique_ptr<LoadedGame>> loading =
+        std::async(std::launch::async, loadGame, bundleLoaded ? &bundle : nullptr, seed, config);
+    std::unique_ptr<LoadedGame> game;
+
+    // Wait for the user to press Enter and for the loading thread to finish; Enter pressed while loading starts the
+    // game as soon as it is ready
+    bool startRequested = false;
+    while (window.isOpen() && !(startRequested && game)) {
+        sf::Event event;
+        while (window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed)
+                window.close();
+
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Enter) {
+                startRequested = true;
+            }
+        }
+
+        if (!game && loading.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            // Textures are uploaded on this thread, which owns the window's GL context
+            game = loading.get();
+            if (!game->loaded || (!bundleLoaded && (!atlas.loadFromImage(game->atlasImage, game->rects) ||
+                                                    !font.loadFromMemory(game->fontData.data(), game->fontData.size())))) {
+                return -1; // Ensure that the graphics and font files are available in the specified directories
+            }
+        }
+
+        window.clear();
+        window.draw(startScreenSprite);
+        window.display();
+        startScreenPacer.wait();
+    }
+    if (!window.isOpen()) {
+        return 0; // Closed on the start screen; leaving main waits for the loading thread
+    }
+    // The world was created by the loading thread: centipede, mushroom field, spider and spaceship
+    // The per-centipede work of a tick is spread over every core but one, which is left to this thread for drawing; a
+    // game with few centipedes stays on the simulation thread
+    ThreadPool pool(std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1));
+    GameWorld& world = *game->world;
+    world.setThreadPool(&pool);
+
+    // One quad batch per render layer, each drawn with a single draw call from the atlas. Mushrooms are kept rendered
+    // in a texture of their own since they rarely change.
+    MushroomLayer mushroomLayer(atlas);
+    if (!mushroomLayer.create(config.worldWidth, config.worldHeight)) {
+        return -1;
+    }
+    SpriteBatch centipedeLayer(atlas);
+    SpriteBatch actorLayer(atlas);      // Spaceship and spider
+    SpriteBatch laserLayer(atlas);
+    SpriteBatch hudLayer(atlas);        // Life icons, rebuilt when the lives change
+    sf::View worldView(sf::FloatRect(0.f, 0.f, static_cast<float>(config.worldWidth), static_cast<float>(config.worldHeight)));
+    Vec2f shownWorldSize = config.getWorldSize(); // World size the mushroom layer and the view were made for
+
+    FramePacer pacer(pacingMode, frameRate);
+    LatencyMonitor latency;
+    InputQueue::Clock::time_point lastFrame = InputQueue::Clock::now();
+    float tickLength = 1.f / simRate;
+    uint64_t shownInputTicks = 0;
+
+    // Score display; the text and life icons are only laid out again when the values they show change
+    int shownScore = -1;
+    int shownLives = -1;
+    sf::Text scoreText;
+    scoreText.setFont(font);
+    scoreText.setCharacterSize(24);
+    scoreText.setFillColor(sf::Color::White);
+    scoreText.setPosition(10.f, 10.f);
+
+    // Game Over text
+    sf::Text gameOverText;
+    gameOverText.setFont(font);
+    gameOverText.setCharacterSize(72);
+    gameOverText.setFillColor(sf::Color::Red); // Red font for the Game Over text. 
+    gameOverText.setString("GAME OVER");
+    gameOverText.setPosition(SCREEN_WIDTH / 2.f - 200.f, SCREEN_HEIGHT / 2.f - 50.f);
+
+    // You Win text
+    sf::Text youWinText;
+    youWinText.setFont(font);
+    youWinText.setCharacterSize(72);
+    youWinText.setFillColor(sf::Color::Green); // Green font for the You Win text. 
+    youWinText.setString("YOU WIN");
+    youWinText.setPosition(SCREEN_WIDTH / 2.f - 150.f, SCREEN_HEIGHT / 2.f - 50.f);
+
+    ProfilerOverlay profilerOverlay(font);
+    profilerOverlay.setLatencyMonitor(&latency);
+
+    // Hand the world to the simulation thread, starting from a snapshot of the first level
+    Simulation simulation;
+    simulation.world = &world;
+    simulation.tickRate = simRate;
+    simulation.seed = seed;
+    simulation.recordPath = recordPath;
+    simulation.recordingGame = !recordPath.empty();
+    simulation.snapshots.getWriteBuffer().capture(world);
+    simulation.snapshots.getWriteBuffer().tickEnd = InputQueue::Clock::now();
+    simulation.snapshots.publish();
+    std::thread simulationThread(runSimulation, std::ref(simulation));
+
+    // Reads the pending window events; called at the start of a frame and while the frame pacer waits, so each event
+    // is timestamped close to when it arrived
+    auto pollEvents = [&]() {
+        sf::Event event;
+        while (window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed)
+                window.close();
+
+            // Every press or release of a control key is queued for the tick it happened in and starts a latency
+            // measurement. Releases that happen while the window is not focused never arrive.
+            InputQueue::Clock::time_point now = InputQueue::Clock::now();
+            if ((event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased) &&
+                getControlKey(event.key.code) != 0) {
+                {
+                    std::lock_guard<std::mutex> lock(simulation.inputMutex);
+                    simulation.inputQueue.push(getControlKey(event.key.code), event.type == sf::Event::KeyPressed, now);
+                }
+                latency.inputReceived(now);
+            }
+            if (event.type == sf::Event::LostFocus) {
+                std::lock_guard<std::mutex> lock(simulation.inputMutex);
+                simulation.inputQueue.releaseAll(now);
+            }
+
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+                profilerOverlay.toggle();
+            }
+
+            // Saving and loading touch the world, so the simulation thread does them before its next tick
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5) {
+                simulation.quickSaveRequested.store(true);
+            }
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F9) {
+                simulation.quickLoadRequested.store(true);
+            }
+        }
+    };
+
+    // Main loop: draws the latest snapshot the simulation thread published, the same one again if none is newer
+    while (window.isOpen()) {
+        pollEvents();
+
+        InputQueue::Clock::time_point frameStart = InputQueue::Clock::now();
+        float frameTime = std::chrono::duration<float>(frameStart - lastFrame).count();
+        lastFrame = frameStart;
+
+        // A snapshot from a tick that applied key events completes the applied step of the latency measurement
+        if (simulation.snapshots.acquire() && simulation.snapshots.getReadBuffer().inputTicks != shownInputTicks) {
+            shownInputTicks = simulation.snapshots.getReadBuffer().inputTicks;
+            latency.inputApplied();
+        }
+        const RenderSnapshot& snapshot = simulation.snapshots.getReadBuffer();
+        bool finished = snapshot.gameOver || snapshot.youWin;
+
+        // A quick load of a game from another level changes the world size; the mushroom texture and the view follow
+        if (snapshot.worldSize != shownWorldSize) {
+            shownWorldSize = snapshot.worldSize;
+            worldView.reset(sf::FloatRect(0.f, 0.f, shownWorldSize.x, shownWorldSize.y));
+            if (!mushroomLayer.create(static_cast<unsigned int>(shownWorldSize.x),
+                                      static_cast<unsigned int>(shownWorldSize.y))) {
+                std::cerr << "Could not create the mushroom layer for the loaded world" << std::endl;
+                window.close();
+                continue;
+            }
+        }
+
+        if (!finished) {
+            // Update the score text only when the score changed, since setString lays out every glyph again
+            PROFILE_SCOPE("HUD text");
+            if (snapshot.score != shownScore) {
+                shownScore = snapshot.score;
+                char scoreString[32];
+                std::snprintf(scoreString, sizeof(scoreString), "Score: %d", shownScore);
+                scoreText.setString(scoreString);
+            }
+        }
+
+        // Rendering, with moving entities drawn between their previous and current tick positions. The snapshot
+        // shows the end of its latest tick, so it is drawn one tick behind real time to always have both ends.
+        {
+            PROFILE_SCOPE("render");
+            window.clear();
+            float alpha = std::chrono::duration<float>(frameStart - snapshot.tickEnd).count() / tickLength;
+            alpha = std::min(std::max(alpha, 0.f), 1.f);
+
+            if (snapshot.youWin) {
+                // Draw "YOU WIN" screen
+                window.draw(youWinText);
+            } else if (snapshot.gameOver) {
+                // Draw game over screen
+                window.draw(gameOverText);
+            } else {
+                // The world is drawn scaled to the window, the HUD after it at screen scale
+                window.setView(worldView);
+
+                // Draw mushrooms from the cached layer, redrawing only the cells hit since the last frame
+                mushroomLayer.update(snapshot.mushrooms);
+                window.draw(mushroomLayer);
+
+                // Draw centipedes
+                centipedeLayer.clear();
+                for (const RenderEntity& head : snapshot.centipedeHeads) {
+                    Vec2f position = lerp(head.previous, head.current, alpha);
+                    centipedeLayer.add(SPRITE_CENTIPEDE_HEAD, position.x, position.y);
+                }
+                for (const RenderEntity& body : snapshot.centipedeBodies) {
+                    Vec2f position = lerp(body.previous, body.current, alpha);
+                    centipedeLayer.add(SPRITE_CENTIPEDE_BODY, position.x, position.y);
+                }
+                window.draw(centipedeLayer);
+
+                // Draw spaceship if not game over, and the spiders that are alive
+                actorLayer.clear();
+                Vec2f shipPosition = lerp(snapshot.spaceship.previous, snapshot.spaceship.current, alpha);
+                actorLayer.add(SPRITE_SPACESHIP, shipPosition.x, shipPosition.y);
+                for (const RenderEntity& spider : snapshot.spiders) {
+                    Vec2f spiderPosition = lerp(spider.previous, spider.current, alpha);
+                    actorLayer.add(SPRITE_SPIDER, spiderPosition.x, spiderPosition.y);
+                }
+                window.draw(actorLayer);
+
+                // Draw lasers
+                laserLayer.clear();
+                for (const RenderEntity& laser : snapshot.lasers) {
+                    Vec2f position = lerp(laser.previous, laser.current, alpha);
+                    laserLayer.add(SPRITE_LASER, position.x, position.y);
+                }
+                window.draw(laserLayer);
+                window.setView(window.getDefaultView());
+
+                // Draw score
+                window.draw(scoreText);
+
+                // Draw lives (depicted as spaceship sprites), rebuilt only when a life is lost or restored
+                if (snapshot.lives != shownLives) {
+                    shownLives = snapshot.lives;
+                    hudLayer.clear();
+                    for (int i = 0; i < shownLives; ++i) {
+                        hudLayer.add(SPRITE_SPACESHIP, SCREEN_WIDTH - (i + 1) * 50.f - 10.f, 10.f);
+                    }
+                }
+                window.draw(hudLayer);
+            }
+
+            profilerOverlay.update(frameTime);
+            window.draw(profilerOverlay);
+        }
+
+        {
+            PROFILE_SCOPE("display");
+            window.display();
+        }
+        latency.frameDisplayed(LatencyMonitor::Clock::now());
+        {
+            PROFILE_SCOPE("frame pacing");
+            pacer.wait(pollEvents);
+        }
+        profiler.endFrame();
+    }
+
+    // The world belongs to this thread again once the simulation thread has stopped
+    simulation.running.store(false);
+    simulationThread.join();
+    if (simulation.recordingGame) {
+        endRecording(simulation);
+    }
+
+    LatencyMonitor::Stats latencyStats = latency.getStats();
+    if (latencyStats.samples > 0) {
+        std::cout << "input to display latency: " << latencyStats.samples << " inputs, average "
+                  << latencyStats.sessionAverageMs << " ms, max " << latencyStats.sessionMaxMs << " ms, last "
+                  << LatencyMonitor::HISTORY_SAMPLES << " inputs min " << latencyStats.minMs << " ms, p99 "
+                  << latencyStats.p99Ms << " ms" << std::endl;
+    }
+
+    if (!tracePath.empty() && !profiler.writeTrace(tracePath)) {
+        std::cerr << "Could not write trace " << tracePath << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Movement and collision logic of the centipede enemy.
+*/
+
+#include "ECE_Centipede.h"
+#include "CentipedeKernels.h"
+#include <algorithm>
+#include <cstring>
+
+/*
+Creates a centipede with no segments, to be filled in by loadState().
+*/
+ECE_Centipede::ECE_Centipede()
+    : first(0), count(0), followDistance(30.f), direction(1.f, 0.f), moveDirectionDown(true), leftBound(0.f),
+      rightBound(SCREEN_WIDTH), lowerBound(SCREEN_HEIGHT) {}
+
+/*
+This is the constructor for the centipede. It initializes the head of the centipede and then adds several body segments behind it. The
+inputs are the arena that stores the segments, the sizes of the head and body of the centipede, the number of segments to create,
+the starting position of the Centipede and the size of the world it turns around in.
+*/
+ECE_Centipede::ECE_Centipede(SegmentArena& arena, Vec2f headSize, Vec2f bodySize, int numSegments, Vec2f startPosition,
+                             Vec2f worldSize)
+    : first(arena.allocate(numSegments)), count(numSegments), headSize(headSize), bodySize(bodySize), followDistance(30.f),
+      direction(1.f, 0.f), moveDirectionDown(true), leftBound(0.f), rightBound(worldSize.x), lowerBound(worldSize.y) {
+
+    // Initialize the head and create the body segments behind it.
+    for (size_t i = 0; i < count; ++i) {
+        arena.x[first + i] = arena.previousX[first + i] = startPosition.x;
+        arena.y[first + i] = arena.previousY[first + i] = startPosition.y + i * followDistance;
+    }
+}
+
+/*
+The update function is called every frame to move the centipede across the screen.
+It handles moving the head of the centipede based on its direction and then makes sure each body segment follows the one before it.
+It also ensures the centipede changes direction when it reaches the boundary of the screen. This function takes deltaTime as input,
+which controls the speed of movement based on the time since the last update, and the speed in pixels per second.
+The body segments follow the positions from the start of the tick, before the head moves. Because the segment in front
+also moves one step this tick, the follow threshold is lowered by one step, which keeps the same spacing as chasing
+the already-moved segment on straight runs. With ticks longer than the spacing (coarse ticks or fast levels) the
+threshold stops at zero and a segment moves at most to where the segment in front was, so it trails one tick behind
+instead of overshooting.
+*/
+void ECE_Centipede::update(SegmentArena& arena, float deltaTime, float speed) {
+    float step = speed * deltaTime;
+    float* x = arena.x.data() + first;
+    float* y = arena.y.data() + first;
+
+    // Keep the positions of the previous tick for render interpolation
+    std::memcpy(arena.previousX.data() + first, x, count * sizeof(float));
+    std::memcpy(arena.previousY.data() + first, y, count * sizeof(float));
+
+    // Update the rest of the segments to follow the head
+    followSegments(x, y, count, std::max(0.f, followDistance - step), step);
+
+    // Move the head based on the current direction
+    x[0] += direction.x * step;
+    y[0] += direction.y * step;
+
+    // Check for collisions with screen boundaries
+    checkBounds(arena);
+}
+
+/*
+This function checks if the head of the centipede has collided with a mushroom.
+If a collision is detected, the centipede changes direction to simulate it hitting an obstacle.
+This function takes the mushroom field to check for collisions; only the cells under the head are looked at.
+Besides the cells under the head, the strip its leading edge crossed during the tick is checked too, so a head that
+moves more than a mushroom width per tick still turns at the first mushroom in its way.
+*/
+void ECE_Centipede::checkMushroomCollision(SegmentArena& arena, const MushroomField& mushrooms) {
+    FloatRect headBounds = getSegmentBounds(arena, 0);
+
+    // Strip between the old and the new position of the leading edge: everything the head passed over this tick,
+    // including mushrooms it would have skipped with a large step
+    float startX = arena.previousX[first];
+    float endX = arena.x[first];
+    FloatRect crossed;
+    if (endX > startX) {
+        crossed = FloatRect(startX + headBounds.width, headBounds.top, endX - startX, headBounds.height);
+    } else {
+        crossed = FloatRect(endX, headBounds.top, startX - endX, headBounds.height);
+    }
+
+    MushroomCell cell;
+    if (mushrooms.findFirstOverlap(headBounds, cell) || mushrooms.findFirstOverlap(crossed, cell)) {
+        // Change direction when the head collides with a mushroom
+        direction = Vec2f(-direction.x, direction.y);
+        moveVertically(arena, getSegmentPosition(arena, 0));
+    }
+}
+
+/*
+This function finds the segment a laser runs into first during the tick. Both the laser and the segments moved this
+tick, so each segment is tested with a swept test on the relative movement from their positions at the start of the
+tick; a fast laser cannot pass through a segment between two ticks.
+- Input: the segment arena, laserStart is the laser bounds at the start of the tick and laserDisplacement its movement.
+- Output: Returns true if a segment is hit; segment receives its index and timeOfImpact the fraction of the tick at
+  which it is reached. Segments reached at the same moment are resolved head first.
+*/
+bool ECE_Centipede::findLaserHit(const SegmentArena& arena, const FloatRect& laserStart, Vec2f laserDisplacement,
+                                 size_t& segment, float& timeOfImpact) const {
+    bool found = false;
+    for (size_t i = 0; i < count; ++i) {
+        float impact;
+        if (sweepSegment(arena, i, laserStart, laserDisplacement, impact) && (!found || impact < timeOfImpact)) {
+            segment = i;
+            timeOfImpact = impact;
+            found = true;
+        }
+    }
+    return found;
+}
+
+/*
+Swept test of one segment against a box moving over the tick, on their relative movement.
+- Input: the segment arena, i is the segment index, start is the box at the start of the tick and displacement its
+  movement over the tick.
+- Output: Returns true if they overlap during the tick; timeOfImpact receives the first moment of overlap.
+*/
+bool ECE_Centipede::sweepSegment(const SegmentArena& arena, size_t i, const FloatRect& start, Vec2f displacement,
+                                 float& timeOfImpact) const {
+    Vec2f segmentStart(arena.previousX[first + i], arena.previousY[first + i]);
+    Vec2f moved = getSegmentPosition(arena, i) - segmentStart;
+    return sweepIntersects(start, displacement - moved, FloatRect(segmentStart, i == 0 ? headSize : bodySize), timeOfImpact);
+}
+
+/*
+This function applies a laser hit to one segment of the centipede.
+It either removes the head, splits the centipede into two, or simply removes the body segment that got hit.
+All three only change index ranges into the arena. On a split this centipede keeps the front half and the back half is
+appended to centipedes. The score is updated accordingly. Inputs are the index of the segment hit, the centipedes
+vector, score for updating the player's points. Returns true if the laser is used up, which is when the centipede is
+fully destroyed or split.
+*/
+bool ECE_Centipede::hitByLaser(size_t i, std::vector<ECE_Centipede>& centipedes, int& score) {
+    if (i == 0) {
+        // If the head is hit, remove it and make the next segment the new head
+        ++first;
+        --count;
+        score += 100; // Increment score by 100 for hitting the head
+    } else if (i == count - 1) {
+        // If the tail is hit, just remove it
+        --count;
+        score += 10; // Increment score by 10 for hitting a body segment
+    } else {
+        // If a body segment is hit, split the centipede into two: [0, i) keeps the same direction and
+        // [i + 1, count) reverses it. Both halves start out moving down, like a new centipede.
+        ECE_Centipede backHalf = *this;
+        backHalf.first = first + i + 1;
+        backHalf.count = count - i - 1;
+        backHalf.direction = -direction; // Reverse direction for the second half
+        backHalf.moveDirectionDown = true;
+
+        count = i; // The first half keeps the same direction
+        moveDirectionDown = true;
+
+        score += 10; // Increment score by 10 for hitting a body segment
+
+        // Appending may move this centipede, so nothing is touched after it
+        centipedes.push_back(backHalf);
+        return true;
+    }
+    return count == 0; // Return true if centipede is fully destroyed
+}
+
+/*
+This function moves the head vertically, either up or down, based on the current direction.
+It is used when the centipede changes direction after hitting an obstacle or boundary.
+- Input: the segment arena and headPosition, which is the current position of the head segment.
+*/
+void ECE_Centipede::moveVertically(SegmentArena& arena, Vec2f headPosition) {
+    arena.x[first] = headPosition.x;
+    if (moveDirectionDown) {
+        arena.y[first] = headPosition.y + Y_DISPLACEMENT;
+    } else {
+        arena.y[first] = headPosition.y - Y_DISPLACEMENT;
+    }
+
+    if (headPosition.y <= 0) {
+        moveDirectionDown = false;
+    }
+
+    if ((headPosition.y + 27) >= lowerBound) {
+        moveDirectionDown = true;
+    }
+}
+
+/*
+This function checks if the centipede head has reached the boundaries of the screen.
+If it does, it changes the movement direction accordingly.
+*/
+void ECE_Centipede::checkBounds(SegmentArena& arena) {
+    Vec2f headPosition = getSegmentPosition(arena, 0);
+    if (headPosition.x <= leftBound) {
+        direction = Vec2f(1.f, 0.f);
+        moveVertically(arena, headPosition);
+    } else if ((headPosition.x + 27) >= rightBound) {
+        direction = Vec2f(-1.f, 0.f);
+        moveVertically(arena, headPosition);
+    }
+
+    if (headPosition.y <= 0) {
+        moveDirectionDown = true;
+    } else if ((headPosition.y + Y_DISPLACEMENT + 27) > lowerBound) {
+        moveDirectionDown = false;
+    }
+}
+
+// - Input: writer receives the index range and movement state of the centipede; the segments live in the arena.
+void ECE_Centipede::saveState(StateWriter& writer) const {
+    writer.write<uint64_t>(first);
+    writer.write<uint64_t>(count);
+    writer.write(headSize);
+    writer.write(bodySize);
+    writer.write(followDistance);
+    writer.write(direction);
+    writer.write(moveDirectionDown);
+    writer.write(leftBound);
+    writer.write(rightBound);
+    writer.write(lowerBound);
+}
+
+/*
+Restores the centipede written by saveState().
+- Input: reader positioned at the centipede state, arena already restored, which must hold the segment range.
+- Output: Returns false if the state is cut short, or the range is empty or lies outside the arena.
+*/
+bool ECE_Centipede::loadState(StateReader& reader, const SegmentArena& arena) {
+    uint64_t firstIndex = 0;
+    uint64_t segmentCount = 0;
+    reader.read(firstIndex);
+    reader.read(segmentCount);
+    reader.read(headSize);
+    reader.read(bodySize);
+    reader.read(followDistance);
+    reader.read(direction);
+    reader.read(moveDirectionDown);
+    reader.read(leftBound);
+    reader.read(rightBound);
+    reader.read(lowerBound);
+    first = static_cast<size_t>(firstIndex);
+    count = static_cast<size_t>(segmentCount);
+    return reader.isValid() && count >= 1 && first < arena.size() && count <= arena.size() - first;
+}
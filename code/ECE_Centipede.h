@@ -0,0 +1,88 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Declaration of the centipede enemy used by the simulation core.
+*/
+
+#pragma once
+
+#include "GameConstants.h"
+#include "MushroomField.h"
+#include "SegmentArena.h"
+#include "StateStream.h"
+#include <vector>
+
+/*
+The EceCentipede class represents the centipede enemy in the game.
+It can move across the screen, change direction when it hits the boundary or a mushroom,
+and can split into multiple centipedes when hit by a laser. This class handles all movement and collision logic for the centipede.
+The segment positions live in a SegmentArena shared by all centipedes; a centipede is the index range
+[first, first + count) of that arena plus its movement state. Segment 0 of the range is the head. Sprites are only
+built by the windowed game when it draws.
+*/
+class ECE_Centipede {
+public:
+    ECE_Centipede();
+    ECE_Centipede(SegmentArena& arena, Vec2f headSize, Vec2f bodySize, int numSegments, Vec2f startPosition = {0.f, 0.f},
+                  Vec2f worldSize = Vec2f(SCREEN_WIDTH, SCREEN_HEIGHT));
+
+    void update(SegmentArena& arena, float deltaTime, float speed);
+    void checkMushroomCollision(SegmentArena& arena, const MushroomField& mushrooms);
+    bool findLaserHit(const SegmentArena& arena, const FloatRect& laserStart, Vec2f laserDisplacement, size_t& segment,
+                      float& timeOfImpact) const;
+    bool hitByLaser(size_t segment, std::vector<ECE_Centipede>& centipedes, int& score);
+    bool sweepSegment(const SegmentArena& arena, size_t i, const FloatRect& start, Vec2f displacement, float& timeOfImpact) const;
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader, const SegmentArena& arena);
+
+    // - Output: Returns the area covered by segment i.
+    FloatRect getSegmentBounds(const SegmentArena& arena, size_t i) const {
+        Vec2f size = i == 0 ? headSize : bodySize;
+        return FloatRect(arena.x[first + i], arena.y[first + i], size.x, size.y);
+    }
+
+    // - Output: Returns the position of segment i.
+    Vec2f getSegmentPosition(const SegmentArena& arena, size_t i) const {
+        return Vec2f(arena.x[first + i], arena.y[first + i]);
+    }
+
+    // - Output: Returns the position of segment i, interpolated between the previous and the current tick by alpha.
+    Vec2f getInterpolatedPosition(const SegmentArena& arena, size_t i, float alpha) const {
+        return lerp(Vec2f(arena.previousX[first + i], arena.previousY[first + i]),
+                    Vec2f(arena.x[first + i], arena.y[first + i]), alpha);
+    }
+
+    // - Output: Returns the swept area covered by segment i over the tick, from its previous to its current position.
+    FloatRect getSweptSegmentBounds(const SegmentArena& arena, size_t i) const {
+        Vec2f start(arena.previousX[first + i], arena.previousY[first + i]);
+        return getSweptBounds(FloatRect(start, i == 0 ? headSize : bodySize), getSegmentPosition(arena, i) - start);
+    }
+
+    // - Output: Returns the arena index of the head.
+    size_t getFirstIndex() const {
+        return first;
+    }
+
+    // - Output: Returns the number of segments left, 0 once the centipede is destroyed.
+    size_t getSegmentCount() const {
+        return count;
+    }
+
+private:
+    size_t first;                      // Arena index of the head
+    size_t count;                      // Number of segments, head included
+    Vec2f headSize;                    // Size of the head segment
+    Vec2f bodySize;                    // Size of every body segment
+    float followDistance;              // Distance each segment tries to maintain from the one in front
+    Vec2f direction;                   // Current direction of movement
+    bool moveDirectionDown;            // True if moving down, false if moving up
+    float leftBound;                   // Left boundary for movement
+    float rightBound;                  // Right boundary for movement
+    float lowerBound;                  // Lower boundary for movement
+
+    void moveVertically(SegmentArena& arena, Vec2f headPosition);
+    void checkBounds(SegmentArena& arena);
+};
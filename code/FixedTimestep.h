@@ -0,0 +1,59 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Accumulator that turns variable frame times into a whole number of fixed-length simulation ticks. The time left over
+after the last tick is exposed as an interpolation factor so the renderer can draw between the previous and the
+current tick.
+*/
+
+#pragma once
+
+#include <algorithm>
+
+class FixedTimestep {
+public:
+    /*
+    - Input: tickRate is the number of simulation ticks per second, maxTicksPerFrame limits how many ticks a single
+      frame may run while catching up, maxBacklog is the most time (in seconds) kept waiting; anything older is
+      dropped.
+    */
+    explicit FixedTimestep(float tickRate, int maxTicksPerFrame = 8, float maxBacklog = 0.25f)
+        : tickLength(1.f / tickRate), maxTicksPerFrame(maxTicksPerFrame), maxBacklog(maxBacklog), accumulator(0.f) {}
+
+    /*
+    Adds the time of a frame and returns how many ticks to run for it. After a stall the backlog is worked off over the
+    following frames, maxTicksPerFrame at a time.
+    - Input: frameTime in seconds since the previous call.
+    - Output: Returns the number of ticks to run this frame.
+    */
+    int advance(float frameTime) {
+        accumulator = std::min(accumulator + frameTime, maxBacklog);
+        int ticks = std::min(static_cast<int>(accumulator / tickLength), maxTicksPerFrame);
+        accumulator -= ticks * tickLength;
+        return ticks;
+    }
+
+    // - Output: Returns the fraction of a tick accumulated but not yet simulated, in [0, 1].
+    float getAlpha() const {
+        return std::min(accumulator / tickLength, 1.f);
+    }
+
+    // - Output: Returns the time accumulated but not yet simulated, in seconds.
+    float getAccumulated() const {
+        return accumulator;
+    }
+
+    // - Output: Returns the length of one tick in seconds.
+    float getTickLength() const {
+        return tickLength;
+    }
+
+private:
+    float tickLength;       // Seconds per tick
+    int maxTicksPerFrame;   // Most ticks run in a single frame
+    float maxBacklog;       // Most time kept in the accumulator
+    float accumulator;      // Time not yet simulated
+};
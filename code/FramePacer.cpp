@@ -0,0 +1,90 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the frame pacer.
+*/
+
+#include "FramePacer.h"
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+const double SLEEP_QUANTUM = 0.001;    // Seconds asked for by each short sleep
+const long long SLEEP_HISTORY = 1000;  // Sleeps the estimate averages over at most
+
+/*
+- Input: mode of pacing, frameRate in frames per second used by the capped mode.
+*/
+FramePacer::FramePacer(PacingMode mode, float frameRate)
+    : mode(mode), framePeriod(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / frameRate))),
+      nextFrame(Clock::now()), sleepMean(SLEEP_QUANTUM), sleepVariance(0.0), sleepCount(1) {}
+
+/*
+Moves the deadline to the start of the next frame. A frame that ran over its length starts the next one right away
+instead of trying to catch up with shorter frames.
+- Output: Returns true if there is time left to wait.
+*/
+bool FramePacer::beginWait() {
+    if (mode != PACING_CAPPED) {
+        return false;
+    }
+    nextFrame += framePeriod;
+    Clock::time_point now = Clock::now();
+    if (nextFrame <= now) {
+        nextFrame = now;
+        return false;
+    }
+    return true;
+}
+
+/*
+Sleeps one short piece if a sleep that wakes up as late as usual (mean plus one standard deviation) still ends before
+the deadline, and updates the sleep length statistics with how long it took.
+- Output: Returns false without sleeping once the rest of the wait is too short to sleep through.
+*/
+bool FramePacer::sleepOnce() {
+    Clock::time_point before = Clock::now();
+    double remaining = std::chrono::duration<double>(nextFrame - before).count();
+    if (remaining <= sleepMean + std::sqrt(sleepVariance)) {
+        return false;
+    }
+    std::this_thread::sleep_for(std::chrono::duration<double>(SLEEP_QUANTUM));
+    double slept = std::chrono::duration<double>(Clock::now() - before).count();
+
+    // Welford update of the sleep length statistics
+    if (sleepCount < SLEEP_HISTORY) {
+        ++sleepCount;
+    }
+    double delta = slept - sleepMean;
+    sleepMean += delta / sleepCount;
+    sleepVariance += (delta * (slept - sleepMean) - sleepVariance) / sleepCount;
+    return true;
+}
+
+// Spins until the deadline, giving the core away between checks.
+void FramePacer::spinUntilDeadline() const {
+    while (Clock::now() < nextFrame) {
+        std::this_thread::yield();
+    }
+}
+
+/*
+Reads a pacing mode from its command line name.
+- Input: name is "vsync", "cap" or "uncapped".
+- Output: Returns false if the name is unknown; mode receives the mode otherwise.
+*/
+bool FramePacer::parseMode(const char* name, PacingMode& mode) {
+    if (std::strcmp(name, "vsync") == 0) {
+        mode = PACING_VSYNC;
+    } else if (std::strcmp(name, "cap") == 0) {
+        mode = PACING_CAPPED;
+    } else if (std::strcmp(name, "uncapped") == 0) {
+        mode = PACING_UNCAPPED;
+    } else {
+        return false;
+    }
+    return true;
+}
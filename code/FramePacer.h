@@ -0,0 +1,70 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The FramePacer holds the game loop to a frame rate. In capped mode wait() blocks until the start of the next frame:
+it sleeps in short pieces while the deadline is far away and spins for the last stretch, since a sleep can wake up
+late. How late is measured on every sleep, so the spin is only as long as this machine needs. The caller can do work
+between the sleeps, such as reading input events so they get timestamps finer than a frame. In vsync mode the buffer
+swap does the waiting and in uncapped mode nothing waits.
+*/
+
+#pragma once
+
+#include <chrono>
+
+// How the game loop is held to a frame rate
+enum PacingMode {
+    PACING_VSYNC,     // The display swap blocks until the vertical blank
+    PACING_CAPPED,    // wait() holds every frame to a fixed length
+    PACING_UNCAPPED   // Frames run back to back
+};
+
+class FramePacer {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    FramePacer(PacingMode mode, float frameRate);
+
+    /*
+    In capped mode, blocks until the start of the next frame. Between the short sleeps idle is called, so the caller can
+    keep reading events while it waits; the spin at the end does not call it.
+    - Input: idle is called with no arguments.
+    */
+    template <typename Idle>
+    void wait(const Idle& idle) {
+        if (!beginWait()) {
+            return;
+        }
+        while (sleepOnce()) {
+            idle();
+        }
+        spinUntilDeadline();
+    }
+
+    // Waits for the next frame without doing anything in between.
+    void wait() {
+        wait([] {});
+    }
+
+    static bool parseMode(const char* name, PacingMode& mode);
+
+    // - Output: Returns the pacing mode.
+    PacingMode getMode() const {
+        return mode;
+    }
+
+private:
+    bool beginWait();
+    bool sleepOnce();
+    void spinUntilDeadline() const;
+
+    PacingMode mode;
+    Clock::duration framePeriod;   // Length of one frame in capped mode
+    Clock::time_point nextFrame;   // Start of the next frame
+    double sleepMean;              // Average length of one short sleep, in seconds
+    double sleepVariance;          // Variance of the sleep length, in seconds squared
+    long long sleepCount;          // Sleeps measured, capped so the estimate keeps adapting
+};
@@ -0,0 +1,179 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Level file parsing and validation of the game config.
+*/
+
+#include "GameConfig.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+const int MIN_WORLD_SIZE = 200;      // Smallest world side that still fits the player area and a centipede turn
+const int MAX_WORLD_SIZE = 16384;    // Largest world side, a common GPU texture limit for the mushroom layer
+const int MAX_ENTITY_COUNT = 1 << 20; // Most mushrooms, centipedes, segments or spiders, to keep level files sane
+
+/*
+Reads a level file, replacing the values it lists. Nothing is replaced if the file has an error.
+- Input: path of the level file.
+- Output: Returns false if the file cannot be read, has an unknown key or a bad value, or the result fails
+  validate(); error then describes the problem.
+*/
+bool GameConfig::load(const std::string& path, std::string& error) {
+    std::ifstream in(path);
+    if (!in) {
+        error = "cannot read " + path;
+        return false;
+    }
+
+    GameConfig config = *this;
+    struct IntKey {
+        const char* name;
+        int* value;
+    };
+    struct FloatKey {
+        const char* name;
+        float* value;
+    };
+    const IntKey intKeys[] = {
+        {"world_width", &config.worldWidth},       {"world_height", &config.worldHeight},
+        {"top_buffer", &config.topBuffer},         {"bottom_buffer", &config.bottomBuffer},
+        {"mushrooms", &config.mushroomCount},      {"centipedes", &config.centipedeCount},
+        {"centipede_segments", &config.centipedeSegments}, {"spiders", &config.spiderCount},
+        {"lives", &config.startLives},
+    };
+    const FloatKey floatKeys[] = {
+        {"ship_speed", &config.shipSpeed},         {"laser_speed", &config.laserSpeed},
+        {"centipede_speed", &config.centipedeSpeed}, {"spider_speed", &config.spiderSpeed},
+        {"shot_interval", &config.shotInterval},   {"spider_respawn_time", &config.spiderRespawnTime},
+    };
+
+    std::string line;
+    for (int lineNumber = 1; std::getline(in, line); ++lineNumber) {
+        std::string where = path + ":" + std::to_string(lineNumber) + ": ";
+        if (line.empty() || line[0] == '#' || line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        size_t equals = line.find('=');
+        std::istringstream keyStream(line.substr(0, equals));
+        std::istringstream valueStream(equals == std::string::npos ? std::string() : line.substr(equals + 1));
+        std::string key;
+        std::string value;
+        std::string extra;
+        if (equals == std::string::npos || !(keyStream >> key) || !(valueStream >> value) || (valueStream >> extra)) {
+            error = where + "expected key = value";
+            return false;
+        }
+
+        char* end = nullptr;
+        bool known = false;
+        for (const IntKey& intKey : intKeys) {
+            if (key == intKey.name) {
+                long parsed = std::strtol(value.c_str(), &end, 10);
+                if (*end != '\0' || parsed < -MAX_ENTITY_COUNT || parsed > MAX_ENTITY_COUNT) {
+                    error = where + "bad integer for " + key;
+                    return false;
+                }
+                *intKey.value = static_cast<int>(parsed);
+                known = true;
+            }
+        }
+        for (const FloatKey& floatKey : floatKeys) {
+            if (key == floatKey.name) {
+                *floatKey.value = std::strtof(value.c_str(), &end);
+                if (*end != '\0') {
+                    error = where + "bad number for " + key;
+                    return false;
+                }
+                known = true;
+            }
+        }
+        if (!known) {
+            error = where + "unknown key " + key;
+            return false;
+        }
+    }
+
+    if (!config.validate(error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    *this = config;
+    return true;
+}
+
+/*
+Checks that the values describe a playable world.
+- Output: Returns false and describes the first problem in error if a value is out of range.
+*/
+bool GameConfig::validate(std::string& error) const {
+    if (worldWidth < MIN_WORLD_SIZE || worldHeight < MIN_WORLD_SIZE || worldWidth > MAX_WORLD_SIZE ||
+        worldHeight > MAX_WORLD_SIZE) {
+        error = "world size must be between " + std::to_string(MIN_WORLD_SIZE) + " and " +
+                std::to_string(MAX_WORLD_SIZE) + " pixels";
+    } else if (!(shipSpeed > 0.f) || !(laserSpeed > 0.f) || !(centipedeSpeed > 0.f) || !(spiderSpeed > 0.f)) {
+        error = "speeds must be positive";
+    } else if (!(shotInterval >= 0.f) || !(spiderRespawnTime >= 0.f)) {
+        error = "shot_interval and spider_respawn_time must not be negative";
+    } else if (topBuffer < 0 || bottomBuffer < 0 || topBuffer + bottomBuffer >= worldHeight) {
+        error = "top_buffer and bottom_buffer must leave room for mushrooms";
+    } else if (mushroomCount < 0 || spiderCount < 0) {
+        error = "mushrooms and spiders must not be negative";
+    } else if (centipedeCount < 1 || centipedeSegments < 1 ||
+               static_cast<long long>(centipedeCount) * centipedeSegments > MAX_ENTITY_COUNT) {
+        error = "centipedes and centipede_segments must be at least 1 and at most " +
+                std::to_string(MAX_ENTITY_COUNT) + " segments in total";
+    } else if (startLives < 1) {
+        error = "lives must be at least 1";
+    } else {
+        return true;
+    }
+    return false;
+}
+
+// - Input: writer receives every value.
+void GameConfig::saveState(StateWriter& writer) const {
+    writer.write(worldWidth);
+    writer.write(worldHeight);
+    writer.write(shipSpeed);
+    writer.write(laserSpeed);
+    writer.write(centipedeSpeed);
+    writer.write(spiderSpeed);
+    writer.write(shotInterval);
+    writer.write(spiderRespawnTime);
+    writer.write(topBuffer);
+    writer.write(bottomBuffer);
+    writer.write(mushroomCount);
+    writer.write(centipedeCount);
+    writer.write(centipedeSegments);
+    writer.write(spiderCount);
+    writer.write(startLives);
+}
+
+/*
+Restores the values written by saveState().
+- Input: reader positioned at the config.
+- Output: Returns false if the state is cut short or the values fail validate().
+*/
+bool GameConfig::loadState(StateReader& reader) {
+    reader.read(worldWidth);
+    reader.read(worldHeight);
+    reader.read(shipSpeed);
+    reader.read(laserSpeed);
+    reader.read(centipedeSpeed);
+    reader.read(spiderSpeed);
+    reader.read(shotInterval);
+    reader.read(spiderRespawnTime);
+    reader.read(topBuffer);
+    reader.read(bottomBuffer);
+    reader.read(mushroomCount);
+    reader.read(centipedeCount);
+    reader.read(centipedeSegments);
+    reader.read(spiderCount);
+    reader.read(startLives);
+    std::string error;
+    return reader.isValid() && validate(error);
+}
@@ -0,0 +1,58 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+A GameConfig holds everything that sets the size and load of a game: the world size, the speeds, the shot interval,
+the number of mushrooms, centipedes and spiders, and the lives. The defaults are the classic level from
+GameConstants.h. A level file replaces any of them at startup, so a level can be tuned or scaled up without
+recompiling. The config is part of the saved world state, so recordings and snapshots of any level play back exactly.
+
+Level file format: one "key = value" pair per line; blank lines and lines starting with # are ignored. Keys that are
+not listed keep their default. Keys:
+    world_width, world_height          World size in pixels
+    ship_speed, laser_speed             Pixels per second
+    centipede_speed, spider_speed       Pixels per second
+    shot_interval                       Seconds between two shots
+    spider_respawn_time                 Seconds before a dead spider comes back
+    top_buffer, bottom_buffer           Rows of pixels kept free of mushrooms, the bottom one is the player area
+    mushrooms                           Mushrooms placed at the start, capped by the free cells
+    centipedes, centipede_segments      Starting centipedes and the segments of each one, head included
+    spiders                             Spiders in the world at once, 0 for none
+    lives                               Lives the player starts with
+*/
+
+#pragma once
+
+#include "GameConstants.h"
+#include "StateStream.h"
+#include <string>
+
+struct GameConfig {
+    int worldWidth = SCREEN_WIDTH;
+    int worldHeight = SCREEN_HEIGHT;
+    float shipSpeed = SHIP_SPEED;
+    float laserSpeed = LASER_SPEED;
+    float centipedeSpeed = CENTIPEDE_SPEED;
+    float spiderSpeed = SPIDER_SPEED;
+    float shotInterval = SHOT_INTERVAL;
+    float spiderRespawnTime = SPIDER_RESPAWN_TIME;
+    int topBuffer = TOP_BUFFER;
+    int bottomBuffer = BOTTOM_BUFFER;
+    int mushroomCount = MUSHROOM_COUNT;
+    int centipedeCount = 1;
+    int centipedeSegments = CENTIPEDE_SEGMENTS;
+    int spiderCount = 1;
+    int startLives = START_LIVES;
+
+    bool load(const std::string& path, std::string& error);
+    bool validate(std::string& error) const;
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader);
+
+    // - Output: Returns the world size in pixels.
+    Vec2f getWorldSize() const {
+        return Vec2f(static_cast<float>(worldWidth), static_cast<float>(worldHeight));
+    }
+};
@@ -0,0 +1,43 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Global constants shared by the simulation core, the windowed game and the headless runner. The level values (world
+size, speeds, counts and lives) are the defaults of GameConfig, which a level file can replace at startup.
+*/
+
+#pragma once
+
+#include "GameMath.h"
+
+// Global constants for screen dimensions and settings
+const int SCREEN_WIDTH = 1036;
+const int SCREEN_HEIGHT = 569;
+const int Y_DISPLACEMENT = 25;    // Vertical displacement when moving down or up
+const float SHIP_SPEED = 300.f;   // Speed of the spaceship
+const float LASER_SPEED = 600.f;  // Speed of the laser blast
+const float SHOT_INTERVAL = 0.6f; // Interval between laser shots in seconds
+const float CENTIPEDE_SPEED = 450.f; // Speed of the centipede
+const float SPIDER_SPEED = 200.f;  // Speed of the spider
+const int TOP_BUFFER = 50;        // Top buffer area without mushrooms
+const int BOTTOM_BUFFER = 100;    // Bottom buffer area without mushrooms
+const float SPIDER_RESPAWN_TIME = 5.f; // Seconds before a dead spider comes back
+const int MUSHROOM_COUNT = 30;    // Number of mushrooms placed at the start of a game
+const int CENTIPEDE_SEGMENTS = 12; // Head plus body segments of the starting centipede
+const int START_LIVES = 2;        // Lives the player starts with
+const float SIM_TICK_RATE = 120.f; // Default simulation ticks per second
+
+/*
+Sizes of the sprites used for collision bounds. The defaults match the PNGs in graphics/, and the windowed game
+overwrites them with the loaded texture sizes so the bounds always match what is drawn.
+*/
+struct EntitySizes {
+    Vec2f centipedeHead{24.f, 27.f};
+    Vec2f centipedeBody{22.f, 24.f};
+    Vec2f mushroom{27.f, 26.f};
+    Vec2f spaceship{21.f, 27.f};
+    Vec2f laser{9.f, 27.f};
+    Vec2f spider{48.f, 29.f};
+};
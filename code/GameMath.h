@@ -0,0 +1,113 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Small vector and rectangle types used by the simulation core. They mirror the parts of sf::Vector2f and sf::FloatRect
+that the game logic needs so the simulation can be built and run without SFML or a window.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// 2D vector of floats used for positions, directions and sizes
+struct Vec2f {
+    float x;
+    float y;
+
+    Vec2f() : x(0.f), y(0.f) {}
+    Vec2f(float x, float y) : x(x), y(y) {}
+
+    Vec2f operator+(const Vec2f& o) const { return Vec2f(x + o.x, y + o.y); }
+    Vec2f operator-(const Vec2f& o) const { return Vec2f(x - o.x, y - o.y); }
+    Vec2f operator-() const { return Vec2f(-x, -y); }
+    Vec2f operator*(float s) const { return Vec2f(x * s, y * s); }
+    Vec2f& operator+=(const Vec2f& o) { x += o.x; y += o.y; return *this; }
+    bool operator==(const Vec2f& o) const { return x == o.x && y == o.y; }
+    bool operator!=(const Vec2f& o) const { return !(*this == o); }
+};
+
+// Axis-aligned rectangle, same layout and overlap rule as sf::FloatRect
+struct FloatRect {
+    float left;
+    float top;
+    float width;
+    float height;
+
+    FloatRect() : left(0.f), top(0.f), width(0.f), height(0.f) {}
+    FloatRect(float left, float top, float width, float height) : left(left), top(top), width(width), height(height) {}
+    FloatRect(Vec2f position, Vec2f size) : left(position.x), top(position.y), width(size.x), height(size.y) {}
+
+    /*
+    Returns true if the two rectangles overlap. Touching edges do not count as an overlap, which matches
+    sf::FloatRect::intersects for rectangles with positive size.
+    */
+    bool intersects(const FloatRect& o) const {
+        return left < o.left + o.width && o.left < left + width &&
+               top < o.top + o.height && o.top < top + height;
+    }
+};
+
+/*
+Swept overlap test: a rectangle moving in a straight line by displacement during one tick against a rectangle that
+stays put. For two moving rectangles pass the difference of their displacements. Uses the same strict overlap rule as
+FloatRect::intersects on each axis.
+- Input: moving is the rectangle at the start of the tick, displacement its movement over the tick, target the other
+  rectangle at the start of the tick.
+- Output: Returns true if the rectangles overlap at some point of the tick; timeOfImpact receives the first moment of
+  overlap as a fraction of the tick, 0 if they already overlap at the start.
+*/
+inline bool sweepIntersects(const FloatRect& moving, Vec2f displacement, const FloatRect& target, float& timeOfImpact) {
+    float enter = 0.f;
+    float exit = 1.f;
+
+    // Open interval of time during which the two rectangles overlap on one axis
+    auto clipAxis = [&](float start, float size, float delta, float targetStart, float targetSize) {
+        float gapBefore = targetStart - (start + size);  // Movement needed before the near edges touch
+        float gapAfter = targetStart + targetSize - start; // Movement after which the far edges separate
+        if (delta == 0.f) {
+            return gapBefore < 0.f && gapAfter > 0.f;
+        }
+        float t0 = gapBefore / delta;
+        float t1 = gapAfter / delta;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        enter = std::max(enter, t0);
+        exit = std::min(exit, t1);
+        return enter < exit;
+    };
+
+    if (!clipAxis(moving.left, moving.width, displacement.x, target.left, target.width) ||
+        !clipAxis(moving.top, moving.height, displacement.y, target.top, target.height)) {
+        return false;
+    }
+    timeOfImpact = enter;
+    return true;
+}
+
+// Returns the smallest rectangle that holds bounds over the whole of a movement by displacement
+inline FloatRect getSweptBounds(const FloatRect& bounds, Vec2f displacement) {
+    return FloatRect(std::min(bounds.left, bounds.left + displacement.x), std::min(bounds.top, bounds.top + displacement.y),
+                     bounds.width + std::abs(displacement.x), bounds.height + std::abs(displacement.y));
+}
+
+// Function to calculate the distance between two points
+inline float distance(Vec2f a, Vec2f b) {
+    return std::sqrt((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y));
+}
+
+// Linear interpolation between two points, t = 0 gives a and t = 1 gives b
+inline Vec2f lerp(Vec2f a, Vec2f b, float t) {
+    return Vec2f(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+}
+
+// Function to normalize a vector
+inline Vec2f normalize(Vec2f v) {
+    float mag = std::sqrt(v.x * v.x + v.y * v.y);
+    if (mag == 0) return Vec2f(0, 0);
+    return Vec2f(v.x / mag, v.y / mag);
+}
@@ -0,0 +1,77 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Capturing, restoring, saving and loading of world snapshots.
+*/
+
+#include "GameSnapshot.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+static const char SNAPSHOT_MAGIC[4] = {'C', 'S', 'N', 'P'};
+
+/*
+Captures the current state of a world, replacing the previous snapshot.
+- Input: world to capture.
+*/
+void GameSnapshot::capture(const GameWorld& world) {
+    buffer.clear();
+    buffer.writeBytes(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    buffer.write(SNAPSHOT_VERSION);
+    buffer.write(world.sizes);
+    world.saveState(buffer);
+}
+
+/*
+Puts a world back into the captured state. The thread pool of the world is kept.
+- Input: world created with the same sprite sizes as the captured one.
+- Output: Returns false if the snapshot is empty, from another version, made with other sprite sizes or damaged; the
+  world must then be reset() before it is stepped again.
+*/
+bool GameSnapshot::restore(GameWorld& world) const {
+    StateReader reader(buffer.getData(), buffer.getSize());
+    char magic[4];
+    uint32_t version;
+    EntitySizes sizes;
+    if (!reader.readBytes(magic, sizeof(magic)) || std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 ||
+        !reader.read(version) || version != SNAPSHOT_VERSION || !reader.read(sizes) ||
+        std::memcmp(&sizes, &world.sizes, sizeof(sizes)) != 0) {
+        return false;
+    }
+    return world.loadState(reader) && reader.isAtEnd();
+}
+
+/*
+Writes the snapshot to a file.
+- Input: path of the file.
+- Output: Returns false if the snapshot is empty or the file cannot be written.
+*/
+bool GameSnapshot::save(const std::string& path) const {
+    if (isEmpty()) {
+        return false;
+    }
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(buffer.getData()), static_cast<std::streamsize>(getSize()));
+    return static_cast<bool>(out);
+}
+
+/*
+Reads a snapshot written by save(). It is only checked when it is restored.
+- Input: path of the file.
+- Output: Returns false if the file cannot be read.
+*/
+bool GameSnapshot::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    buffer.clear();
+    buffer.writeBytes(bytes.data(), bytes.size());
+    return true;
+}
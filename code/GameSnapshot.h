@@ -0,0 +1,42 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+A GameSnapshot holds the complete state of a GameWorld as one compact byte buffer: a small header (magic "CSNP",
+version and the sprite sizes of the world) followed by the state written by GameWorld::saveState(). Capturing and
+restoring only copy packed arrays, and the buffer is reused between captures, so a game can be snapshotted every tick
+for rollback or branched into many simulations. Snapshots can also be written to a file to save and resume a game;
+files are only meant to be read by the same build.
+*/
+
+#pragma once
+
+#include "GameWorld.h"
+#include "StateStream.h"
+#include <string>
+
+const uint32_t SNAPSHOT_VERSION = 3;  // Bumped whenever the state layout changes, old snapshots are then rejected
+
+class GameSnapshot {
+public:
+    void capture(const GameWorld& world);
+    bool restore(GameWorld& world) const;
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    // - Output: Returns true if no state has been captured or loaded yet.
+    bool isEmpty() const {
+        return buffer.getSize() == 0;
+    }
+
+    // - Output: Returns the size of the snapshot in bytes.
+    size_t getSize() const {
+        return buffer.getSize();
+    }
+
+private:
+    StateWriter buffer;
+};
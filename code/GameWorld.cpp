@@ -0,0 +1,614 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the game world. step() runs the same sequence of updates and collision checks every tick:
+centipedes, spiders, spaceship, lasers, and finally the hits on the spaceship.
+Collisions between moving objects are swept over the tick from the positions at its start, so they hold at any tick
+length: a laser cannot jump over a segment or a mushroom between two ticks.
+*/
+
+#include "GameWorld.h"
+#include "Profiler.h"
+#include <algorithm>
+
+// Centipedes handed to a thread at a time. Each takes well under a microsecond per tick, so small groups would cost
+// more in hand-offs than they save; a normal game with a few centipedes stays on the calling thread.
+const size_t CENTIPEDES_PER_TASK = 32;
+const size_t LASERS_PER_TASK = 32;         // Lasers handed to a thread at a time in the laser hit search
+const float GRID_CELL_SIZE = 64.f;         // Side of a broadphase cell, a little over two segments
+const uint32_t NO_OWNER = UINT32_MAX;      // Owner of an arena slot whose segment was destroyed
+const uint32_t SPIDER_ID = 0x80000000u;    // Set in the grid ids of spiders, whose low bits are the spider index
+
+// Lasers in flight from which the grid is built. Building costs about as much as testing fifteen lasers against every
+// segment directly, so with fewer lasers the direct tests are cheaper. Both give the same hits.
+const size_t GRID_MIN_LASERS = 16;
+
+// Timer pool entries beyond one per spider: the fire cooldown, with room for more kinds of timed events
+const size_t EXTRA_TIMERS = 16;
+
+/*
+Creates an empty world. reset() must be called before the first step().
+- Input: sizes of the sprites used for collision bounds, config of the level.
+*/
+GameWorld::GameWorld(const EntitySizes& sizes, const GameConfig& config)
+    : sizes(sizes), config(config), score(0), lives(config.startLives), gameOver(false), youWin(false),
+      laserReady(true), threadPool(nullptr), useCollisionGrid(false), centipedesChanged(false), spiderRespawnTicks(1) {
+    applyConfig();
+    spaceshipPosition = initialPosition;
+    previousSpaceshipPosition = initialPosition;
+    laserHits.reserve(MAX_LASERS);
+}
+
+/*
+Sets up what follows from the config: the spawn point of the spaceship, the broadphase grid and an empty timer pool
+large enough for the spiders.
+*/
+void GameWorld::applyConfig() {
+    initialPosition = Vec2f(config.worldWidth / 2.f, static_cast<float>(config.worldHeight - config.bottomBuffer) + 20.f);
+    collisionGrid.resize(static_cast<float>(config.worldWidth), static_cast<float>(config.worldHeight), GRID_CELL_SIZE);
+    timers.reset(static_cast<size_t>(config.spiderCount) + EXTRA_TIMERS);
+}
+
+/*
+Attaches a thread pool for the parallel passes of step(), or detaches it.
+- Input: pool to use, or nullptr to run every pass on the calling thread. The pool must outlive its use by the world.
+*/
+void GameWorld::setThreadPool(ThreadPool* pool) {
+    threadPool = pool;
+}
+
+/*
+Starts a new game of the level in config: its centipedes, a random mushroom field, new spiders and a respawned
+spaceship. The game that follows depends only on the seed, the config and the inputs passed to step().
+- Input: seed of the random generator.
+*/
+void GameWorld::reset(unsigned int seed) {
+    applyConfig();
+    Vec2f worldSize = config.getWorldSize();
+
+    // Create the centipedes, spread along the top of the world (swarm levels use hundreds). Every split adds one
+    // centipede and destroys one segment, so there can never be more centipedes than starting segments; reserving
+    // that many keeps splits from allocating.
+    size_t count = static_cast<size_t>(config.centipedeCount);
+    size_t segmentCount = count * config.centipedeSegments;
+    segments.clear();
+    segments.reserve(segmentCount);
+    centipedes.clear();
+    centipedes.reserve(segmentCount);
+    for (size_t i = 0; i < count; ++i) {
+        Vec2f start(worldSize.x * static_cast<float>(i) / count, 0.f);
+        centipedes.emplace_back(segments, sizes.centipedeHead, sizes.centipedeBody, config.centipedeSegments, start,
+                                worldSize);
+    }
+
+    // Fill the mushroom field using a random generator. Mushrooms snap to cells of the grid, so a cell that is
+    // already taken is skipped and another one is drawn.
+    int columns = static_cast<int>(std::ceil(worldSize.x / sizes.mushroom.x));
+    int rows = static_cast<int>(std::ceil(worldSize.y / sizes.mushroom.y));
+    mushrooms.resize(sizes.mushroom, columns, rows);
+
+    random.seed(seed);
+    int lastColumn = static_cast<int>((config.worldWidth - 100) / sizes.mushroom.x);
+    int firstRow = static_cast<int>(std::ceil(config.topBuffer / sizes.mushroom.y));
+    int lastRow = static_cast<int>((config.worldHeight - config.bottomBuffer) / sizes.mushroom.y);
+
+    int freeCells = std::max(0, (lastColumn + 1) * (lastRow - firstRow + 1));
+    int target = std::min(config.mushroomCount, freeCells);
+    while (static_cast<int>(mushrooms.getCount()) < target) {
+        int column = random.nextInt(0, lastColumn);
+        int row = random.nextInt(firstRow, lastRow);
+        mushrooms.place(column, row);
+    }
+
+    spiders.clear();
+    for (int i = 0; i < config.spiderCount; ++i) {
+        spiders.emplace_back(sizes.spider, worldSize, random);
+    }
+    lasers.clear();
+    spaceshipPosition = initialPosition;
+    previousSpaceshipPosition = initialPosition;
+    score = 0;
+    lives = config.startLives;
+    gameOver = false;
+    youWin = false;
+    laserReady = true;
+}
+
+/*
+Writes the complete game state: everything step() reads or writes, except what it rebuilds from scratch every tick
+(the broadphase grid and the per-laser hits).
+- Input: writer receives the state.
+*/
+void GameWorld::saveState(StateWriter& writer) const {
+    config.saveState(writer);
+    segments.saveState(writer);
+    writer.write<uint64_t>(centipedes.size());
+    for (const auto& centipede : centipedes) {
+        centipede.saveState(writer);
+    }
+    mushrooms.saveState(writer);
+    writer.write(random.state);
+    writer.write(random.increment);
+    writer.write<uint64_t>(spiders.size());
+    for (const auto& spider : spiders) {
+        spider.saveState(writer);
+    }
+    lasers.saveState(writer);
+    writer.write(spaceshipPosition);
+    writer.write(previousSpaceshipPosition);
+    writer.write(score);
+    writer.write(lives);
+    writer.write(gameOver);
+    writer.write(youWin);
+    writer.write(laserReady);
+    timers.saveState(writer);
+}
+
+/*
+Restores a state written by saveState(), on a world created with the same sizes. Storage is reused, so restoring a
+world of the same scale as the current one allocates nothing and can be done every tick.
+- Input: reader positioned at the world state.
+- Output: Returns false if the state is cut short or inconsistent; the world must then be reset() before it is
+  stepped again.
+*/
+bool GameWorld::loadState(StateReader& reader) {
+    if (!config.loadState(reader)) {
+        return false;
+    }
+    applyConfig();
+    uint64_t centipedeCount = 0;
+    if (!segments.loadState(reader) || !reader.read(centipedeCount) || centipedeCount > segments.size()) {
+        return false;
+    }
+    // As in reset(), room for one centipede per arena slot keeps later splits from allocating
+    centipedes.reserve(segments.size());
+    centipedes.resize(static_cast<size_t>(centipedeCount));
+    for (auto& centipede : centipedes) {
+        if (!centipede.loadState(reader, segments)) {
+            return false;
+        }
+    }
+    // Every centipede writes its whole range each tick, so ranges that overlap would corrupt each other
+    if (!updateSegmentOwners() || !mushrooms.loadState(reader)) {
+        return false;
+    }
+    reader.read(random.state);
+    reader.read(random.increment);
+    uint64_t spiderCount = 0;
+    if (!reader.isValid() || !reader.read(spiderCount) || spiderCount != static_cast<uint64_t>(config.spiderCount)) {
+        return false;
+    }
+    spiders.resize(static_cast<size_t>(spiderCount));
+    for (auto& spider : spiders) {
+        if (!spider.loadState(reader)) {
+            return false;
+        }
+    }
+    if (!lasers.loadState(reader)) {
+        return false;
+    }
+    reader.read(spaceshipPosition);
+    reader.read(previousSpaceshipPosition);
+    reader.read(score);
+    reader.read(lives);
+    reader.read(gameOver);
+    reader.read(youWin);
+    reader.read(laserReady);
+    return timers.loadState(reader);
+}
+
+/*
+Hashes the complete game state, to check that two runs of the same seed and inputs ended in exactly the same state.
+Positions are hashed bit for bit, so the hash is only stable between runs of the same build.
+- Output: Returns the 64-bit hash.
+*/
+uint64_t GameWorld::computeStateHash() const {
+    StateWriter writer;
+    saveState(writer);
+    return hashBytes(writer.getData(), writer.getSize());
+}
+
+/*
+Advances the simulation by one tick.
+- Input: input holds the player controls for this tick, deltaTime is the length of the tick in seconds.
+*/
+void GameWorld::step(const InputState& input, float deltaTime) {
+    if (gameOver || youWin) {
+        return;
+    }
+
+    // Fire the timed events due this tick
+    spiderRespawnTicks = TimerWheel::secondsToTicks(config.spiderRespawnTime, deltaTime);
+    timers.advance([this](uint16_t kind, uint32_t data) { fireTimer(kind, data); });
+
+    // Update centipedes and turn them at mushrooms. Destroyed centipedes are removed when they are hit, so every one
+    // here has segments. A centipede only writes its own range of the arena and only reads the mushrooms, so the
+    // centipedes can be processed in parallel.
+    {
+        PROFILE_SCOPE("centipede update");
+        forEachCentipede([&](size_t begin, size_t end, int) {
+            for (size_t i = begin; i < end; ++i) {
+                centipedes[i].update(segments, deltaTime, config.centipedeSpeed);
+                centipedes[i].checkMushroomCollision(segments, mushrooms);
+            }
+        });
+    }
+
+    // Check if all centipedes are destroyed (player wins)
+    if (centipedes.empty()) {
+        youWin = true;
+    }
+
+    // Update the spiders. A killed spider comes back when its respawn timer fires.
+    {
+        PROFILE_SCOPE("spider");
+        for (auto& spider : spiders) {
+            spider.update(deltaTime, config.spiderSpeed);
+            spider.checkMushroomCollision(mushrooms);
+        }
+    }
+
+    // Move the spaceship with the arrow keys
+    Vec2f shipPosition = spaceshipPosition;
+    previousSpaceshipPosition = shipPosition;
+    float shipStep = config.shipSpeed * deltaTime; // The ship speed gives you control of how fast you want the ship.
+    if (input.up && shipPosition.y > config.worldHeight - config.bottomBuffer) {
+        spaceshipPosition.y -= shipStep;
+    }
+    if (input.down && shipPosition.y < config.worldHeight - sizes.spaceship.y) {
+        spaceshipPosition.y += shipStep;
+    }
+    if (input.left && shipPosition.x > 0) {
+        spaceshipPosition.x -= shipStep;
+    }
+    if (input.right && shipPosition.x < config.worldWidth - sizes.spaceship.x) {
+        spaceshipPosition.x += shipStep;
+    }
+
+    // Shooting lasers with the fire button, at most once per shot interval
+    if (input.fire && laserReady) {
+        float laserX = shipPosition.x + sizes.spaceship.x / 2.f - sizes.laser.x / 2.f;
+        float laserY = shipPosition.y;
+        if (lasers.spawn(sizes.laser, laserX, laserY)) {
+            laserReady = !timers.schedule(TimerWheel::secondsToTicks(config.shotInterval, deltaTime), TIMER_LASER_READY, 0);
+        }
+    }
+
+    // Move the lasers, find the centipede segment each one reaches first (in parallel over the lasers), then
+    // resolve the hits one laser at a time. A laser is removed when it hits something or when it leaves the screen.
+    // Hits come first so a laser that reaches a target on its last tick still counts.
+    {
+        PROFILE_SCOPE("lasers");
+        lasers.update(deltaTime, config.laserSpeed);
+
+        // The segments and spiders do not move again this tick: index them for the laser and spaceship hit tests
+        useCollisionGrid = lasers.size() >= GRID_MIN_LASERS;
+        if (useCollisionGrid) {
+            PROFILE_SCOPE("broadphase");
+            buildCollisionGrid();
+        }
+        findCentipedeHits();
+
+        // Hits were found against the centipedes as they were before any laser of this tick hit them. Once a hit has
+        // split or shortened a centipede, later lasers look for their centipede hit again.
+        centipedesChanged = false;
+        for (size_t i = 0; i < lasers.size();) {
+            CentipedeHit centipedeHit = laserHits[i];
+            if (centipedesChanged) {
+                centipedeHit = findCentipedeHit(lasers.getStartBounds(i), lasers.getDisplacement(i));
+            }
+            if (checkLaserHit(i, centipedeHit) || lasers.isOffScreen(i)) {
+                // The last laser moves into slot i, so do not advance
+                laserHits[i] = laserHits[lasers.size() - 1];
+                laserHits.pop_back();
+                lasers.remove(i);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    // Check for collisions between centipedes and spaceship
+    PROFILE_SCOPE("spaceship hits");
+    FloatRect spaceshipStart(previousSpaceshipPosition, sizes.spaceship);
+    Vec2f spaceshipDisplacement = spaceshipPosition - previousSpaceshipPosition;
+    if (checkSpaceshipHit(spaceshipStart, spaceshipDisplacement)) {
+        loseLife();
+    }
+
+    // Check for collisions between the spiders and the spaceship. A respawned spaceship has not moved this tick. At
+    // most one life is lost to spiders per tick, the spaceship is back at its spawn point after it.
+    spaceshipStart = FloatRect(previousSpaceshipPosition, sizes.spaceship);
+    spaceshipDisplacement = spaceshipPosition - previousSpaceshipPosition;
+    if (checkSpiderHit(spaceshipStart, spaceshipDisplacement) && lives > 0) {
+        loseLife();
+    }
+}
+
+/*
+Runs body(begin, end, thread) over the index range of the centipedes, on the thread pool if one is attached.
+*/
+template <typename Body>
+void GameWorld::forEachCentipede(const Body& body) {
+    if (threadPool) {
+        threadPool->parallelFor(centipedes.size(), CENTIPEDES_PER_TASK, body);
+    } else {
+        body(0, centipedes.size(), 0);
+    }
+}
+
+/*
+Builds the broadphase grid over the swept bounds of every segment and living spider for this tick and records which
+centipede owns each arena slot. A spider killed later in the tick stays in the grid; its own hit tests skip it.
+*/
+void GameWorld::buildCollisionGrid() {
+    collisionGrid.clear();
+    for (const auto& centipede : centipedes) {
+        for (size_t i = 0; i < centipede.getSegmentCount(); ++i) {
+            collisionGrid.add(static_cast<uint32_t>(centipede.getFirstIndex() + i),
+                              centipede.getSweptSegmentBounds(segments, i));
+        }
+    }
+    for (size_t s = 0; s < spiders.size(); ++s) {
+        if (spiders[s].getIsAlive()) {
+            collisionGrid.add(SPIDER_ID | static_cast<uint32_t>(s), spiders[s].getSweptGlobalBounds());
+        }
+    }
+    collisionGrid.build();
+    updateSegmentOwners();
+}
+
+/*
+Records the centipede index of every arena slot. Called again after a laser hit, since removing segments and splitting
+centipedes changes which centipede owns a slot; the segments themselves do not move, so the grid stays valid.
+- Output: Returns false if two centipedes claim the same slot, which only a corrupt snapshot can cause.
+*/
+bool GameWorld::updateSegmentOwners() {
+    segmentOwner.assign(segments.size(), NO_OWNER);
+    for (size_t c = 0; c < centipedes.size(); ++c) {
+        size_t first = centipedes[c].getFirstIndex();
+        for (size_t slot = first; slot < first + centipedes[c].getSegmentCount(); ++slot) {
+            if (segmentOwner[slot] != NO_OWNER) {
+                return false;
+            }
+            segmentOwner[slot] = static_cast<uint32_t>(c);
+        }
+    }
+    return true;
+}
+
+/*
+Finds, for every laser, the centipede segment it reaches first this tick. Each laser only writes its own result, so
+the lasers are searched in parallel.
+*/
+void GameWorld::findCentipedeHits() {
+    laserHits.resize(lasers.size());
+    auto body = [&](size_t begin, size_t end, int) {
+        for (size_t l = begin; l < end; ++l) {
+            laserHits[l] = findCentipedeHit(lasers.getStartBounds(l), lasers.getDisplacement(l));
+        }
+    };
+    if (threadPool) {
+        threadPool->parallelFor(lasers.size(), LASERS_PER_TASK, body);
+    } else {
+        body(0, lasers.size(), 0);
+    }
+}
+
+/*
+Finds the centipede segment a laser reaches first this tick. When the grid is built it hands out the segments near the
+swept laser, and each is given the exact swept test; otherwise every centipede is tested. Equal impacts go to the
+lowest centipede index and then the segment nearest the head, the order in which the centipedes are tested one by one.
+- Input: laserStart is the laser bounds at the start of the tick, laserDisplacement its movement.
+- Output: Returns the hit, with found set to false if the laser reaches no segment.
+*/
+GameWorld::CentipedeHit GameWorld::findCentipedeHit(const FloatRect& laserStart, Vec2f laserDisplacement) const {
+    CentipedeHit best = {false, 0, 0, 0.f};
+    if (!useCollisionGrid) {
+        for (size_t c = 0; c < centipedes.size(); ++c) {
+            size_t segment;
+            float impact;
+            if (centipedes[c].findLaserHit(segments, laserStart, laserDisplacement, segment, impact) &&
+                (!best.found || impact < best.timeOfImpact)) {
+                best = {true, c, segment, impact};
+            }
+        }
+        return best;
+    }
+
+    collisionGrid.query(getSweptBounds(laserStart, laserDisplacement), [&](uint32_t slot) {
+        uint32_t owner = (slot & SPIDER_ID) ? NO_OWNER : segmentOwner[slot];
+        if (owner == NO_OWNER) {
+            return;
+        }
+        size_t segment = slot - centipedes[owner].getFirstIndex();
+        float impact;
+        if (centipedes[owner].sweepSegment(segments, segment, laserStart, laserDisplacement, impact) &&
+            (!best.found || impact < best.timeOfImpact ||
+             (impact == best.timeOfImpact && (owner < best.centipede || (owner == best.centipede && segment < best.segment))))) {
+            best = {true, owner, segment, impact};
+        }
+    });
+    return best;
+}
+
+/*
+Checks if any centipede segment touches the spaceship during the tick, using the grid to find the nearby segments when
+it is built.
+- Input: spaceshipStart is the spaceship bounds at the start of the tick, spaceshipDisplacement its movement.
+- Output: Returns true if a segment touches the spaceship.
+*/
+bool GameWorld::checkSpaceshipHit(const FloatRect& spaceshipStart, Vec2f spaceshipDisplacement) const {
+    bool hit = false;
+    float impact;
+    if (!useCollisionGrid) {
+        for (const auto& centipede : centipedes) {
+            for (size_t i = 0; i < centipede.getSegmentCount() && !hit; ++i) {
+                hit = centipede.sweepSegment(segments, i, spaceshipStart, spaceshipDisplacement, impact);
+            }
+        }
+        return hit;
+    }
+
+    collisionGrid.query(getSweptBounds(spaceshipStart, spaceshipDisplacement), [&](uint32_t slot) {
+        uint32_t owner = (slot & SPIDER_ID) ? NO_OWNER : segmentOwner[slot];
+        if (!hit && owner != NO_OWNER &&
+            centipedes[owner].sweepSegment(segments, slot - centipedes[owner].getFirstIndex(), spaceshipStart,
+                                           spaceshipDisplacement, impact)) {
+            hit = true;
+        }
+    });
+    return hit;
+}
+
+/*
+Checks if a living spider touches the spaceship during the tick, using the grid to find the nearby spiders when it is
+built.
+- Input: spaceshipStart is the spaceship bounds at the start of the tick, spaceshipDisplacement its movement.
+- Output: Returns true if a spider touches the spaceship.
+*/
+bool GameWorld::checkSpiderHit(const FloatRect& spaceshipStart, Vec2f spaceshipDisplacement) const {
+    bool hit = false;
+    if (!useCollisionGrid) {
+        for (size_t s = 0; s < spiders.size() && !hit; ++s) {
+            hit = spiders[s].checkSpaceshipCollision(spaceshipStart, spaceshipDisplacement);
+        }
+        return hit;
+    }
+
+    collisionGrid.query(getSweptBounds(spaceshipStart, spaceshipDisplacement), [&](uint32_t id) {
+        if (!hit && (id & SPIDER_ID)) {
+            hit = spiders[id & ~SPIDER_ID].checkSpaceshipCollision(spaceshipStart, spaceshipDisplacement);
+        }
+    });
+    return hit;
+}
+
+/*
+Finds the living spider a laser reaches first this tick, among the spiders near the swept laser when the grid is built
+or among all of them otherwise. Equal impacts go to the lowest spider index.
+- Input: laserStart is the laser bounds at the start of the tick, laserDisplacement its movement, spider and
+  timeOfImpact receive the hit.
+- Output: Returns true if the laser reaches a spider.
+*/
+bool GameWorld::findSpiderHit(const FloatRect& laserStart, Vec2f laserDisplacement, size_t& spider,
+                              float& timeOfImpact) const {
+    bool found = false;
+    float impact;
+    if (!useCollisionGrid) {
+        for (size_t s = 0; s < spiders.size(); ++s) {
+            if (spiders[s].findLaserHit(laserStart, laserDisplacement, impact) && (!found || impact < timeOfImpact)) {
+                found = true;
+                spider = s;
+                timeOfImpact = impact;
+            }
+        }
+        return found;
+    }
+
+    collisionGrid.query(getSweptBounds(laserStart, laserDisplacement), [&](uint32_t id) {
+        size_t s = id & ~SPIDER_ID;
+        if ((id & SPIDER_ID) && spiders[s].findLaserHit(laserStart, laserDisplacement, impact) &&
+            (!found || impact < timeOfImpact || (impact == timeOfImpact && s < spider))) {
+            found = true;
+            spider = s;
+            timeOfImpact = impact;
+        }
+    });
+    return found;
+}
+
+/*
+Sweeps a laser over its movement this tick against mushrooms, centipedes and the spiders and applies the hit it reaches
+first. Hits reached at the same moment go to mushrooms, then centipedes, then the spider with the lowest index.
+A mushroom hit makes it small or destroys it, a centipede hit removes or splits segments, a spider hit kills it.
+- Input: index of a laser that has already been moved for this tick, centipedeHit is the first centipede segment it
+  reaches.
+- Output: Returns true if the laser hit something and must be removed.
+*/
+bool GameWorld::checkLaserHit(size_t laser, const CentipedeHit& centipedeHit) {
+    FloatRect laserStart = lasers.getStartBounds(laser);
+    Vec2f laserDisplacement = lasers.getDisplacement(laser);
+
+    enum { HIT_NONE, HIT_MUSHROOM, HIT_CENTIPEDE, HIT_SPIDER } target = HIT_NONE;
+    float firstImpact = 0.f;
+    float impact;
+
+    // A laser can only hit one mushroom: the first hit makes it small, the second destroys it.
+    MushroomCell cell;
+    if (mushrooms.findFirstSweptOverlap(laserStart, laserDisplacement, cell, impact)) {
+        target = HIT_MUSHROOM;
+        firstImpact = impact;
+    }
+
+    if (centipedeHit.found && (target == HIT_NONE || centipedeHit.timeOfImpact < firstImpact)) {
+        target = HIT_CENTIPEDE;
+        firstImpact = centipedeHit.timeOfImpact;
+    }
+
+    size_t spiderHit = 0;
+    if (findSpiderHit(laserStart, laserDisplacement, spiderHit, impact) &&
+        (target == HIT_NONE || impact < firstImpact)) {
+        target = HIT_SPIDER;
+        firstImpact = impact;
+    }
+
+    switch (target) {
+        case HIT_MUSHROOM:
+            if (mushrooms.hit(cell)) {
+                score += 4;  // Increment score by 4 only when the mushroom is fully destroyed
+            }
+            return true;
+        case HIT_CENTIPEDE: {
+            bool used = centipedes[centipedeHit.centipede].hitByLaser(centipedeHit.segment, centipedes, score);
+            if (centipedes[centipedeHit.centipede].getSegmentCount() == 0) {
+                centipedes.erase(centipedes.begin() + centipedeHit.centipede);
+            }
+            centipedesChanged = true;
+            if (useCollisionGrid) {
+                updateSegmentOwners();
+            }
+            return used;
+        }
+        case HIT_SPIDER:
+            spiders[spiderHit].hitByLaser(score);
+            timers.schedule(spiderRespawnTicks, TIMER_SPIDER_RESPAWN, static_cast<uint32_t>(spiderHit));
+            return true;
+        default:
+            return false;
+    }
+}
+
+/*
+Applies a timed event whose timer fired at the start of this tick.
+- Input: kind of the timer (a TimerEvent) and its data.
+*/
+void GameWorld::fireTimer(uint16_t kind, uint32_t data) {
+    switch (kind) {
+        case TIMER_LASER_READY:
+            laserReady = true;
+            break;
+        case TIMER_SPIDER_RESPAWN:
+            if (data < spiders.size()) {
+                spiders[data].setIsAlive(true);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+Removes one life and respawns the spaceship at its initial position. Sets game over when no lives are left.
+*/
+void GameWorld::loseLife() {
+    lives--;
+    spaceshipPosition = initialPosition; // Respawn spaceship to initial position
+    previousSpaceshipPosition = initialPosition; // Jump there instead of sliding across the screen
+    if (lives == 0) {
+        gameOver = true; // Set game over only when all lives are lost
+    }
+}
@@ -0,0 +1,119 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The GameWorld class owns the complete simulation state (centipedes, mushrooms, spiders, lasers, spaceship, score and lives)
+and advances it one tick at a time from an InputState. It has no dependency on SFML so it can run without a window.
+The world size, speeds and entity counts come from its GameConfig, which reset() applies.
+With a ThreadPool attached, the per-centipede work of a tick (movement, mushroom turns, laser hit tests and spaceship
+hit tests) is spread over the pool. Everything those passes find is merged in a fixed order before it is applied, so
+a tick gives the same result on any number of threads.
+When many lasers are in flight, lasers and the spaceship find the centipede segments and spiders they may touch
+through a SpatialGrid built once per tick over the swept bounds of every segment and living spider, so only nearby
+ones get the exact swept test.
+Timed events (the fire cooldown and spider respawns) are timers of a TimerWheel that advances once per step, so they
+follow simulation time: they stop while the game is not stepped and run at full speed in headless runs and replays.
+*/
+
+#pragma once
+
+#include "ECE_Centipede.h"
+#include "GameConfig.h"
+#include "LaserPool.h"
+#include "MushroomField.h"
+#include "Random.h"
+#include "SegmentArena.h"
+#include "SpatialGrid.h"
+#include "Spider.h"
+#include "ThreadPool.h"
+#include "TimerWheel.h"
+#include <vector>
+
+// Player controls sampled for one simulation tick
+struct InputState {
+    bool up = false;
+    bool down = false;
+    bool left = false;
+    bool right = false;
+    bool fire = false;
+};
+
+// Kinds of the timed events of a game, the kind of their TimerWheel timer
+enum TimerEvent {
+    TIMER_LASER_READY,    // The fire cooldown is over
+    TIMER_SPIDER_RESPAWN  // Data is the index of the spider that comes back
+};
+
+class GameWorld {
+public:
+    explicit GameWorld(const EntitySizes& sizes = EntitySizes(), const GameConfig& config = GameConfig());
+
+    void reset(unsigned int seed);
+    void step(const InputState& input, float deltaTime);
+    void setThreadPool(ThreadPool* pool);
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader);
+    uint64_t computeStateHash() const;
+
+    // - Output: Returns true once the player has either won or lost.
+    bool isFinished() const {
+        return gameOver || youWin;
+    }
+
+    // - Output: Returns the area covered by the spaceship.
+    FloatRect getSpaceshipBounds() const {
+        return FloatRect(spaceshipPosition, sizes.spaceship);
+    }
+
+    EntitySizes sizes;                     // Sprite sizes used for collision bounds
+    GameConfig config;                     // Level of the current game; a change takes effect at the next reset()
+    SegmentArena segments;                 // Positions of every centipede segment
+    std::vector<ECE_Centipede> centipedes; // Index ranges into segments, in update and hit-test order
+    MushroomField mushrooms;
+    Pcg32 random;                          // Every random draw of the game, seeded by reset()
+    std::vector<Spider> spiders;           // config.spiderCount spiders, dead ones included
+    LaserPool lasers;
+    Vec2f spaceshipPosition;
+    Vec2f previousSpaceshipPosition;       // Spaceship position at the end of the previous tick
+    int score;
+    int lives;
+    bool gameOver;
+    bool youWin;
+    bool laserReady;                       // False while the fire cooldown timer runs
+    TimerWheel timers;                     // Pending timed events, also the tick count of the game
+
+private:
+    // First segment of a centipede that a laser reaches this tick
+    struct CentipedeHit {
+        bool found;
+        size_t centipede;
+        size_t segment;
+        float timeOfImpact;
+    };
+
+    Vec2f initialPosition;                 // Spawn point of the spaceship, set from the config
+    ThreadPool* threadPool;                // Not owned; null runs every pass on the calling thread
+
+    SpatialGrid collisionGrid;             // Broadphase over segments (arena indices) and spiders (SPIDER_ID | index)
+    bool useCollisionGrid;                 // True if the grid was built this tick
+    std::vector<uint32_t> segmentOwner;    // Centipede index of every arena slot, NO_OWNER for destroyed segments
+    std::vector<CentipedeHit> laserHits;   // First centipede hit of each laser, found in parallel
+    bool centipedesChanged;                // Set once a laser of the current tick has hit a centipede
+    uint32_t spiderRespawnTicks;           // Spider respawn time in ticks of the current step
+
+    template <typename Body>
+    void forEachCentipede(const Body& body);
+    void applyConfig();
+    void fireTimer(uint16_t kind, uint32_t data);
+    void buildCollisionGrid();
+    bool updateSegmentOwners();
+    void findCentipedeHits();
+    bool checkSpaceshipHit(const FloatRect& spaceshipStart, Vec2f spaceshipDisplacement) const;
+    bool checkSpiderHit(const FloatRect& spaceshipStart, Vec2f spaceshipDisplacement) const;
+    CentipedeHit findCentipedeHit(const FloatRect& laserStart, Vec2f laserDisplacement) const;
+    bool findSpiderHit(const FloatRect& laserStart, Vec2f laserDisplacement, size_t& spider, float& timeOfImpact) const;
+    bool checkLaserHit(size_t laser, const CentipedeHit& centipedeHit);
+    void loseLife();
+};
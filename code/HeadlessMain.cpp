@@ -0,0 +1,487 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Headless runner for the simulation core. It steps a GameWorld for a number of ticks with scripted input, without opening
+a window, and reports the simulation throughput in ticks per second. When a game ends a new one is started so every
+tick does real work.
+
+Usage: centipede_headless [--ticks N] [--dt SECONDS | --hz N] [--seed N] [--script FILE] [--trace FILE]
+                          [--level FILE] [--centipedes N] [--threads N] [--record FILE] [--load-state FILE]
+                          [--save-state FILE] [--autoplay] [--check-allocs WARMUP]
+       centipede_headless --replay FILE [--threads N] [--trace FILE]
+       centipede_headless --batch GAMES [--threads N] [--seed N] [--dt SECONDS | --hz N] [--level FILE]
+                          [--centipedes N] [--max-ticks N]
+
+--level plays every game on the level of a level file (see GameConfig.h and levels/) instead of the classic one.
+--centipedes starts every game with N centipedes (a swarm level), replacing the count of the level, and --threads
+spreads the per-centipede work over N threads. The results do not depend on the thread count.
+
+With --trace every tick is one profiler frame: the per-phase statistics of the last frames are printed at the end and
+the timed blocks of the run are written to FILE as a Chrome trace.
+
+--record writes the inputs of the first game, up to its end or the last tick, to FILE. --replay plays a recording
+made here or by the game (Lab1 --record) as fast as possible, then checks that it ended with the recorded score and
+state hash; the exit code is 1 if it did not. Recordings replay exactly on the build that made them.
+
+--load-state starts the first game from a snapshot instead of a new level, and --save-state writes a snapshot of the
+world after the last tick, so a long run can be resumed or branched into several runs. A recording holds only the seed
+and level it starts from, so --record cannot be combined with --load-state.
+
+--autoplay lets the AI player (AutoPlayer) drive the ship instead of the script.
+
+--check-allocs counts the heap allocations of every tick, game restarts included, once the first WARMUP ticks have
+run, and lists the ticks that allocated; the exit code is 1 if any did. It needs a build with CENTIPEDE_ALLOC_TRACKING.
+
+--batch plays GAMES independent games with the AI player, game i with seed N + i, spread over --threads threads with
+one game per thread at a time. A game that has not ended after --max-ticks ticks is stopped and counted as timed out.
+It reports the win rate, the score distribution, the game lengths and the throughput in games per second per thread.
+The statistics do not depend on the thread count.
+
+A script file holds one step per line: a tick count followed by the keys held during those ticks, using U, D, L, R
+and F for up, down, left, right and fire, or - for no keys. Lines starting with # are ignored. The script repeats
+until all ticks have run. Example:
+    120 LF
+    120 RF
+*/
+
+#include "AllocationCounter.h"
+#include "AutoPlayer.h"
+#include "GameSnapshot.h"
+#include "GameWorld.h"
+#include "InputRecording.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+const size_t TRACE_EVENTS = 1 << 20; // Most timed blocks kept in a trace
+const long long BATCH_MAX_TICKS = 100000; // Default tick limit of a batch game, about 14 minutes at 120 Hz
+const int MAX_REPORTED_ALLOCATING_TICKS = 16; // Allocating ticks listed by --check-allocs
+
+// One line of an input script: the keys held for a number of ticks
+struct ScriptStep {
+    int ticks;
+    InputState input;
+};
+
+/*
+Parses a key string such as "LF" into an InputState.
+- Input: keys is the key string from a script line.
+- Output: Returns the input state with the listed keys held.
+*/
+static InputState parseKeys(const std::string& keys) {
+    InputState input;
+    for (char key : keys) {
+        switch (key) {
+            case 'U': input.up = true; break;
+            case 'D': input.down = true; break;
+            case 'L': input.left = true; break;
+            case 'R': input.right = true; break;
+            case 'F': input.fire = true; break;
+            default: break;
+        }
+    }
+    return input;
+}
+
+/*
+Loads an input script from a file.
+- Input: path of the script file, steps receives the parsed lines.
+- Output: Returns false if the file cannot be read or holds no steps.
+*/
+static bool loadScript(const std::string& path, std::vector<ScriptStep>& steps) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream in(line);
+        ScriptStep step;
+        std::string keys;
+        if (in >> step.ticks >> keys && step.ticks > 0) {
+            step.input = parseKeys(keys);
+            steps.push_back(step);
+        }
+    }
+    return !steps.empty();
+}
+
+// Default script: sweep the ship left and right along the bottom while firing
+static std::vector<ScriptStep> defaultScript() {
+    return {
+        {90, parseKeys("LF")},
+        {30, parseKeys("UF")},
+        {180, parseKeys("RF")},
+        {30, parseKeys("DF")},
+        {90, parseKeys("LF")},
+    };
+}
+
+/*
+Plays a recording from its first tick to its last and compares the end state with the recorded one.
+- Input: recording to play, pool for the parallel passes.
+- Output: Returns true if the score and the state hash match.
+*/
+static bool replay(const InputRecording& recording, ThreadPool& pool) {
+    GameWorld world;
+    world.setThreadPool(&pool);
+    world.config = recording.getConfig();
+    world.reset(recording.getSeed());
+
+    Profiler& profiler = Profiler::instance();
+    float deltaTime = recording.getDeltaTime();
+    auto start = std::chrono::steady_clock::now();
+    for (const InputRun& run : recording.getRuns()) {
+        InputState input = unpackKeys(run.keys);
+        for (uint32_t tick = 0; tick < run.ticks; ++tick) {
+            world.step(input, deltaTime);
+            if (profiler.isTracing()) {
+                profiler.endFrame();
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    uint64_t hash = world.computeStateHash();
+    bool matches = world.score == recording.getFinalScore() && hash == recording.getFinalStateHash();
+    std::cout << "ticks: " << recording.getTickCount() << "\n"
+              << "seconds: " << seconds << "\n"
+              << "ticks/sec: " << (seconds > 0.0 ? recording.getTickCount() / seconds : 0.0) << "\n"
+              << "score: " << world.score << " (recorded " << recording.getFinalScore() << ")\n"
+              << std::hex << "state hash: " << hash << " (recorded " << recording.getFinalStateHash() << ")\n"
+              << std::dec << "replay: " << (matches ? "match" : "MISMATCH") << std::endl;
+    return matches;
+}
+
+// Outcome of one game of a batch
+struct GameResult {
+    bool won;
+    bool finished;     // False if the game hit the tick limit
+    int score;
+    long long ticks;
+};
+
+/*
+Plays one game with the AI player until it ends or reaches the tick limit.
+- Input: world to play in (reset here with its config), seed of the game, deltaTime of a tick, maxTicks limit.
+- Output: Returns the outcome.
+*/
+static GameResult playAutoGame(GameWorld& world, unsigned int seed, float deltaTime, long long maxTicks) {
+    AutoPlayer player;
+    world.reset(seed);
+    long long tick = 0;
+    for (; tick < maxTicks && !world.isFinished(); ++tick) {
+        world.step(player.decide(world, deltaTime), deltaTime);
+    }
+    return {world.youWin, world.isFinished(), world.score, tick};
+}
+
+/*
+Plays a batch of independent games on the pool and prints their statistics. Every thread reuses one world, and every
+game writes only its own result, so the threads share nothing while playing.
+- Input: games to play, seed of the first game, config and deltaTime of every game, maxTicks per game, pool.
+*/
+static void runBatch(long long games, unsigned int seed, const GameConfig& config, float deltaTime, long long maxTicks,
+                     ThreadPool& pool) {
+    std::vector<std::unique_ptr<GameWorld>> worlds;
+    for (int t = 0; t < pool.getThreadCount(); ++t) {
+        worlds.emplace_back(new GameWorld(EntitySizes(), config));
+    }
+    std::vector<GameResult> results(static_cast<size_t>(games));
+
+    auto start = std::chrono::steady_clock::now();
+    pool.parallelFor(results.size(), 1, [&](size_t begin, size_t end, int thread) {
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = playAutoGame(*worlds[thread], seed + static_cast<unsigned int>(i), deltaTime, maxTicks);
+        }
+    });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long long wins = 0;
+    long long timeouts = 0;
+    long long totalTicks = 0;
+    double totalScore = 0.0;
+    std::vector<int> scores;
+    std::vector<long long> lengths;
+    for (const GameResult& result : results) {
+        wins += result.won ? 1 : 0;
+        timeouts += result.finished ? 0 : 1;
+        totalTicks += result.ticks;
+        totalScore += result.score;
+        scores.push_back(result.score);
+        lengths.push_back(result.ticks);
+    }
+    std::sort(scores.begin(), scores.end());
+    std::sort(lengths.begin(), lengths.end());
+    auto percentile = [](const auto& sorted, double p) {
+        return sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))];
+    };
+
+    double count = static_cast<double>(games);
+    double gamesPerSecond = seconds > 0.0 ? count / seconds : 0.0;
+    std::cout << "games: " << games << "\n"
+              << "wins: " << wins << " (" << 100.0 * wins / count << "%)\n"
+              << "losses: " << games - wins - timeouts << "\n"
+              << "timed out: " << timeouts << "\n"
+              << "score mean: " << totalScore / count << "\n"
+              << "score min / p10 / p50 / p90 / max: " << scores.front() << " / " << percentile(scores, 0.1) << " / "
+              << percentile(scores, 0.5) << " / " << percentile(scores, 0.9) << " / " << scores.back() << "\n"
+              << "length mean (s): " << totalTicks * deltaTime / count << "\n"
+              << "length p10 / p50 / p90 (s): " << percentile(lengths, 0.1) * deltaTime << " / "
+              << percentile(lengths, 0.5) * deltaTime << " / " << percentile(lengths, 0.9) * deltaTime << "\n"
+              << "threads: " << pool.getThreadCount() << "\n"
+              << "seconds: " << seconds << "\n"
+              << "ticks/sec: " << (seconds > 0.0 ? totalTicks / seconds : 0.0) << "\n"
+              << "games/sec: " << gamesPerSecond << "\n"
+              << "games/sec/thread: " << gamesPerSecond / pool.getThreadCount() << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long ticks = 100000;
+    float deltaTime = 1.f / SIM_TICK_RATE;
+    unsigned int seed = 1;
+    std::vector<ScriptStep> script;
+    std::string tracePath;
+    GameConfig config;
+    int centipedeCount = 0;
+    int threadCount = 1;
+    std::string recordPath;
+    std::string replayPath;
+    std::string loadStatePath;
+    std::string saveStatePath;
+    bool autoplay = false;
+    long long batchGames = 0;
+    long long maxTicks = BATCH_MAX_TICKS;
+    long long allocationWarmup = -1;
+
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            ticks = std::atoll(argv[++i]);
+        } else if (std::strcmp(argv[i], "--dt") == 0 && hasValue) {
+            deltaTime = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--hz") == 0 && hasValue) {
+            deltaTime = 1.f / static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--script") == 0 && hasValue) {
+            if (!loadScript(argv[++i], script)) {
+                std::cerr << "Could not load input script " << argv[i] << std::endl;
+                return -1;
+            }
+        } else if (std::strcmp(argv[i], "--trace") == 0 && hasValue) {
+            tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--level") == 0 && hasValue) {
+            std::string error;
+            if (!config.load(argv[++i], error)) {
+                std::cerr << "Could not load level: " << error << std::endl;
+                return -1;
+            }
+        } else if (std::strcmp(argv[i], "--centipedes") == 0 && hasValue) {
+            centipedeCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            threadCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--record") == 0 && hasValue) {
+            recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && hasValue) {
+            replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--load-state") == 0 && hasValue) {
+            loadStatePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--save-state") == 0 && hasValue) {
+            saveStatePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--autoplay") == 0) {
+            autoplay = true;
+        } else if (std::strcmp(argv[i], "--batch") == 0 && hasValue) {
+            batchGames = std::atoll(argv[++i]);
+        } else if (std::strcmp(argv[i], "--max-ticks") == 0 && hasValue) {
+            maxTicks = std::atoll(argv[++i]);
+        } else if (std::strcmp(argv[i], "--check-allocs") == 0 && hasValue) {
+            allocationWarmup = std::max(0LL, std::atoll(argv[++i]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--ticks N] [--dt SECONDS | --hz N] [--seed N] [--script FILE] [--trace FILE]"
+                      << " [--level FILE] [--centipedes N] [--threads N] [--record FILE] [--load-state FILE]"
+                      << " [--save-state FILE] [--autoplay] [--check-allocs WARMUP]\n"
+                      << "       " << argv[0] << " --replay FILE [--threads N] [--trace FILE]\n"
+                      << "       " << argv[0] << " --batch GAMES [--threads N] [--seed N] [--dt SECONDS | --hz N]"
+                      << " [--level FILE] [--centipedes N] [--max-ticks N]" << std::endl;
+            return -1;
+        }
+    }
+    if (centipedeCount > 0) {
+        config.centipedeCount = centipedeCount;
+    }
+    if (!recordPath.empty() && !loadStatePath.empty()) {
+        std::cerr << "--record cannot be combined with --load-state: a recording replays from a new level" << std::endl;
+        return -1;
+    }
+    if (allocationWarmup >= 0 && !isAllocationTrackingEnabled()) {
+        std::cerr << "--check-allocs needs a build configured with -DCENTIPEDE_ALLOC_TRACKING=ON" << std::endl;
+        return -1;
+    }
+
+    ThreadPool pool(threadCount);
+    Profiler& profiler = Profiler::instance();
+    if (!tracePath.empty()) {
+        profiler.startTrace(TRACE_EVENTS);
+    }
+
+    if (batchGames > 0) {
+        runBatch(batchGames, seed, config, deltaTime, maxTicks, pool);
+        return 0;
+    }
+
+    if (!replayPath.empty()) {
+        InputRecording recording;
+        if (!recording.load(replayPath)) {
+            std::cerr << "Could not load recording " << replayPath << std::endl;
+            return -1;
+        }
+        bool matches = replay(recording, pool);
+        if (!tracePath.empty() && !profiler.writeTrace(tracePath)) {
+            std::cerr << "Could not write trace " << tracePath << std::endl;
+            return -1;
+        }
+        return matches ? 0 : 1;
+    }
+
+    if (script.empty()) {
+        script = defaultScript();
+    }
+
+    GameWorld world(EntitySizes(), config);
+    world.setThreadPool(&pool);
+    world.reset(seed);
+    GameSnapshot snapshot;
+    if (!loadStatePath.empty() && !(snapshot.load(loadStatePath) && snapshot.restore(world))) {
+        std::cerr << "Could not load snapshot " << loadStatePath << std::endl;
+        return -1;
+    }
+
+    AutoPlayer player;
+
+    // The first game is recorded until it ends
+    InputRecording recording;
+    bool recordingGame = !recordPath.empty();
+    if (recordingGame) {
+        recording.begin(seed, world.config, deltaTime);
+    }
+
+    long long games = 1;
+    long long totalScore = 0;
+    size_t scriptIndex = 0;
+    int scriptTick = 0;
+
+    // Ticks past the warm-up that allocated, the first few of them kept in fixed arrays so the check itself does not
+    // allocate
+    long long allocatingTicks = 0;
+    uint64_t allocationsAfterWarmup = 0;
+    long long reportedTicks[MAX_REPORTED_ALLOCATING_TICKS];
+    uint64_t reportedAllocations[MAX_REPORTED_ALLOCATING_TICKS];
+
+    auto start = std::chrono::steady_clock::now();
+    for (long long tick = 0; tick < ticks; ++tick) {
+        InputState input = autoplay ? player.decide(world, deltaTime) : script[scriptIndex].input;
+        if (recordingGame) {
+            recording.record(input);
+        }
+        uint64_t allocationsBefore = getAllocationCount().allocations;
+        world.step(input, deltaTime);
+
+        // Advance through the script, wrapping around at the end
+        if (++scriptTick >= script[scriptIndex].ticks) {
+            scriptTick = 0;
+            scriptIndex = (scriptIndex + 1) % script.size();
+        }
+
+        // Start a new game as soon as the current one ends
+        if (world.isFinished()) {
+            if (recordingGame) {
+                recording.end(world);
+                recordingGame = false;
+            }
+            totalScore += world.score;
+            world.reset(seed + static_cast<unsigned int>(games));
+            ++games;
+        }
+
+        uint64_t tickAllocations = getAllocationCount().allocations - allocationsBefore;
+        if (allocationWarmup >= 0 && tick >= allocationWarmup && tickAllocations > 0) {
+            if (allocatingTicks < MAX_REPORTED_ALLOCATING_TICKS) {
+                reportedTicks[allocatingTicks] = tick;
+                reportedAllocations[allocatingTicks] = tickAllocations;
+            }
+            ++allocatingTicks;
+            allocationsAfterWarmup += tickAllocations;
+        }
+
+        if (!tracePath.empty()) {
+            profiler.endFrame();
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (recordingGame) {
+        recording.end(world); // The first game was still running at the last tick
+    }
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "ticks: " << ticks << "\n"
+              << "seconds: " << seconds << "\n"
+              << "ticks/sec: " << (seconds > 0.0 ? ticks / seconds : 0.0) << "\n"
+              << "games started: " << games << "\n"
+              << "total score: " << totalScore + world.score << "\n"
+              << std::hex << "state hash: " << world.computeStateHash() << std::dec << std::endl;
+
+    if (!saveStatePath.empty()) {
+        snapshot.capture(world);
+        if (!snapshot.save(saveStatePath)) {
+            std::cerr << "Could not write snapshot " << saveStatePath << std::endl;
+            return -1;
+        }
+    }
+    if (!recordPath.empty() && !recording.save(recordPath)) {
+        std::cerr << "Could not write recording " << recordPath << std::endl;
+        return -1;
+    }
+
+    if (allocationWarmup >= 0) {
+        std::cout << "ticks checked for allocations: " << std::max(0LL, ticks - allocationWarmup) << "\n"
+                  << "allocating ticks: " << allocatingTicks << "\n"
+                  << "allocations: " << allocationsAfterWarmup << "\n";
+        for (long long i = 0; i < std::min<long long>(allocatingTicks, MAX_REPORTED_ALLOCATING_TICKS); ++i) {
+            std::cout << "  tick " << reportedTicks[i] << ": " << reportedAllocations[i] << " allocations\n";
+        }
+        std::cout << std::flush;
+    }
+
+    if (!tracePath.empty()) {
+        Profiler::PhaseStats stats[Profiler::MAX_PHASES];
+        int count = profiler.getStats(stats, Profiler::MAX_PHASES);
+        std::cout << "phase (ms per tick, last " << Profiler::HISTORY_FRAMES << " ticks): min / avg / p99\n";
+        for (int i = 0; i < count; ++i) {
+            std::cout << "  " << stats[i].name << ": " << stats[i].minMs << " / " << stats[i].averageMs << " / "
+                      << stats[i].p99Ms << "\n";
+        }
+        if (!profiler.writeTrace(tracePath)) {
+            std::cerr << "Could not write trace " << tracePath << std::endl;
+            return -1;
+        }
+    }
+    return allocatingTicks > 0 ? 1 : 0;
+}
@@ -0,0 +1,63 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the timestamped input queue.
+*/
+
+#include "InputQueue.h"
+
+InputQueue::InputQueue() : head(0), keysDown(0) {
+    events.reserve(64);
+}
+
+/*
+Adds a key event. Events must be pushed in the order they happened.
+- Input: key bit (KEY_UP ... KEY_FIRE), pressed is true for a press and false for a release, time of the event.
+*/
+void InputQueue::push(uint8_t key, bool pressed, Clock::time_point time) {
+    events.push_back({time, key, pressed});
+}
+
+/*
+Releases every key, for when the window loses focus and the releases would never arrive.
+- Input: time of the release.
+*/
+void InputQueue::releaseAll(Clock::time_point time) {
+    events.push_back({time, static_cast<uint8_t>(KEY_UP | KEY_DOWN | KEY_LEFT | KEY_RIGHT | KEY_FIRE), false});
+}
+
+/*
+Applies every event up to the end of a tick and returns the input of that tick: the keys held at its start plus every
+key pressed during it.
+- Input: tickEnd is the real time the tick ends at; ticks must be taken in order.
+- Output: Returns the input of the tick; consumed is set to true if at least one event was applied.
+*/
+InputState InputQueue::takeTick(Clock::time_point tickEnd, bool& consumed) {
+    uint8_t keys = keysDown;
+    consumed = false;
+    for (; head < events.size() && events[head].time <= tickEnd; ++head) {
+        const KeyEvent& event = events[head];
+        if (event.pressed) {
+            keysDown |= event.key;
+            keys |= event.key;
+        } else {
+            keysDown &= ~event.key;
+        }
+        consumed = true;
+    }
+    if (head == events.size()) {
+        events.clear();
+        head = 0;
+    }
+    return unpackKeys(keys);
+}
+
+// Drops every waiting event and releases every key.
+void InputQueue::clear() {
+    events.clear();
+    head = 0;
+    keysDown = 0;
+}
@@ -0,0 +1,43 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The InputQueue turns timestamped key press and release events into the input of each simulation tick. Every event is
+applied to the tick whose time span holds its timestamp, so the input of a tick does not depend on when frames are
+drawn. A key pressed at any point during a tick counts as held for that whole tick, so a tap shorter than a tick, or
+than a frame, still reaches the simulation. Events newer than the last tick of a frame wait for the next frame.
+Keys use the bits of packKeys(), so the tick inputs can be recorded as they are.
+*/
+
+#pragma once
+
+#include "InputRecording.h"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+class InputQueue {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    InputQueue();
+
+    void push(uint8_t key, bool pressed, Clock::time_point time);
+    void releaseAll(Clock::time_point time);
+    InputState takeTick(Clock::time_point tickEnd, bool& consumed);
+    void clear();
+
+private:
+    // One key press or release
+    struct KeyEvent {
+        Clock::time_point time;
+        uint8_t key;
+        bool pressed;
+    };
+
+    std::vector<KeyEvent> events; // In arrival order; capacity is kept when the queue empties
+    size_t head;                  // First event not yet applied to a tick
+    uint8_t keysDown;             // Keys held after every applied event
+};
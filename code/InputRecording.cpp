@@ -0,0 +1,162 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Recording, saving and loading of per-tick input logs.
+*/
+
+#include "InputRecording.h"
+#include "StateStream.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+static const char RECORDING_MAGIC[4] = {'C', 'R', 'E', 'C'};
+
+// - Output: Returns the keys of an input state packed into one byte.
+uint8_t packKeys(const InputState& input) {
+    return (input.up ? KEY_UP : 0) | (input.down ? KEY_DOWN : 0) | (input.left ? KEY_LEFT : 0) |
+           (input.right ? KEY_RIGHT : 0) | (input.fire ? KEY_FIRE : 0);
+}
+
+// - Output: Returns the input state of keys packed by packKeys().
+InputState unpackKeys(uint8_t keys) {
+    InputState input;
+    input.up = (keys & KEY_UP) != 0;
+    input.down = (keys & KEY_DOWN) != 0;
+    input.left = (keys & KEY_LEFT) != 0;
+    input.right = (keys & KEY_RIGHT) != 0;
+    input.fire = (keys & KEY_FIRE) != 0;
+    return input;
+}
+
+InputRecording::InputRecording()
+    : seed(0), deltaTime(1.f / SIM_TICK_RATE), tickCount(0), finalScore(0), finalStateHash(0) {}
+
+/*
+Starts a new recording, dropping any recorded input.
+- Input: seed passed to GameWorld::reset() for this game, config of the world, deltaTime is the tick length.
+*/
+void InputRecording::begin(unsigned int seed, const GameConfig& config, float deltaTime) {
+    this->seed = seed;
+    this->config = config;
+    this->deltaTime = deltaTime;
+    tickCount = 0;
+    finalScore = 0;
+    finalStateHash = 0;
+    runs.clear();
+}
+
+/*
+Adds the input of one tick; call it once before every GameWorld::step().
+- Input: input passed to the step.
+*/
+void InputRecording::record(const InputState& input) {
+    uint8_t keys = packKeys(input);
+    if (runs.empty() || runs.back().keys != keys || runs.back().ticks == UINT32_MAX) {
+        runs.push_back({keys, 0});
+    }
+    ++runs.back().ticks;
+    ++tickCount;
+}
+
+/*
+Stores the result of the recorded game for later checks.
+- Input: world after the last recorded step.
+*/
+void InputRecording::end(const GameWorld& world) {
+    finalScore = world.score;
+    finalStateHash = world.computeStateHash();
+}
+
+/*
+Writes the recording to a file.
+- Input: path of the file.
+- Output: Returns false if the file cannot be written.
+*/
+bool InputRecording::save(const std::string& path) const {
+    StateWriter writer;
+    writer.writeBytes(RECORDING_MAGIC, sizeof(RECORDING_MAGIC));
+    writer.write(RECORDING_VERSION);
+    writer.write<uint32_t>(seed);
+    config.saveState(writer);
+    writer.write(deltaTime);
+    writer.write(tickCount);
+    writer.write<int32_t>(finalScore);
+    writer.write(finalStateHash);
+    writer.write<uint64_t>(runs.size());
+    for (const InputRun& run : runs) {
+        writer.write(run.keys);
+        uint32_t ticks = run.ticks;
+        do {
+            uint8_t byte = ticks & 0x7f;
+            ticks >>= 7;
+            writer.write<uint8_t>(ticks != 0 ? byte | 0x80 : byte);
+        } while (ticks != 0);
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(writer.getData()), static_cast<std::streamsize>(writer.getSize()));
+    return static_cast<bool>(out);
+}
+
+/*
+Reads a recording written by save().
+- Input: path of the file.
+- Output: Returns false if the file cannot be read, is from another version or is damaged; the recording is then
+  unchanged.
+*/
+bool InputRecording::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    StateReader reader(bytes.data(), bytes.size());
+
+    // Everything is read into locals first, so a damaged file leaves the recording as it was
+    char magic[4];
+    uint32_t version;
+    uint32_t fileSeed;
+    GameConfig fileConfig;
+    float fileDeltaTime;
+    uint64_t fileTickCount;
+    int32_t fileScore;
+    uint64_t fileStateHash;
+    uint64_t runCount;
+    if (!reader.readBytes(magic, sizeof(magic)) || std::memcmp(magic, RECORDING_MAGIC, sizeof(magic)) != 0 ||
+        !reader.read(version) || version != RECORDING_VERSION) {
+        return false;
+    }
+    if (!reader.read(fileSeed) || !fileConfig.loadState(reader) || !reader.read(fileDeltaTime) ||
+        !reader.read(fileTickCount) || !reader.read(fileScore) || !reader.read(fileStateHash) ||
+        !reader.read(runCount) || runCount > bytes.size()) {
+        return false;
+    }
+
+    std::vector<InputRun> fileRuns(static_cast<size_t>(runCount));
+    uint64_t ticks = 0;
+    for (InputRun& run : fileRuns) {
+        run.ticks = 0;
+        reader.read(run.keys);
+        uint8_t byte = 0x80;
+        for (int shift = 0; (byte & 0x80) != 0 && shift < 32 && reader.read(byte); shift += 7) {
+            run.ticks |= static_cast<uint32_t>(byte & 0x7f) << shift;
+        }
+        ticks += run.ticks;
+    }
+    if (!reader.isValid() || !reader.isAtEnd() || ticks != fileTickCount) {
+        return false;
+    }
+
+    seed = fileSeed;
+    config = fileConfig;
+    deltaTime = fileDeltaTime;
+    tickCount = fileTickCount;
+    finalScore = fileScore;
+    finalStateHash = fileStateHash;
+    runs.swap(fileRuns);
+    return true;
+}
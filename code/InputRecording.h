@@ -0,0 +1,73 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+An InputRecording holds everything needed to play one game again exactly: the seed passed to GameWorld::reset() and the
+level config it was played with, the tick length, and the input of every tick. Players hold keys for many ticks in a
+row, so the inputs are stored run-length encoded: each run is the five keys packed in one byte and the number of ticks
+they were held for. It also keeps the score and state hash the game ended with, so a replay can check it ended the same way.
+
+File layout: the magic "CREC", a version, the header values, then every run as its key byte followed by its tick
+count as a variable-length integer (7 bits per byte, low bits first). A minute of play is typically well under a
+kilobyte.
+*/
+
+#pragma once
+
+#include "GameWorld.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+const uint32_t RECORDING_VERSION = 3;  // Bumped whenever the file layout or the simulation rules change
+
+// Key bits of a packed input
+const uint8_t KEY_UP = 1 << 0;
+const uint8_t KEY_DOWN = 1 << 1;
+const uint8_t KEY_LEFT = 1 << 2;
+const uint8_t KEY_RIGHT = 1 << 3;
+const uint8_t KEY_FIRE = 1 << 4;
+
+// Keys held for a number of consecutive ticks
+struct InputRun {
+    uint8_t keys;    // One bit per key, see packKeys()
+    uint32_t ticks;
+};
+
+uint8_t packKeys(const InputState& input);
+InputState unpackKeys(uint8_t keys);
+
+class InputRecording {
+public:
+    InputRecording();
+
+    void begin(unsigned int seed, const GameConfig& config, float deltaTime);
+    void record(const InputState& input);
+    void end(const GameWorld& world);
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    unsigned int getSeed() const { return seed; }
+    const GameConfig& getConfig() const { return config; }
+    float getDeltaTime() const { return deltaTime; }
+    uint64_t getTickCount() const { return tickCount; }
+    int getFinalScore() const { return finalScore; }
+    uint64_t getFinalStateHash() const { return finalStateHash; }
+
+    // - Output: Returns the recorded inputs, in tick order.
+    const std::vector<InputRun>& getRuns() const {
+        return runs;
+    }
+
+private:
+    unsigned int seed;
+    GameConfig config;
+    float deltaTime;
+    uint64_t tickCount;
+    int finalScore;
+    uint64_t finalStateHash;
+    std::vector<InputRun> runs;
+};
@@ -0,0 +1,126 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Fixed-capacity storage for the laser shots in flight, kept as packed component arrays: one array per coordinate, and a
+single size shared by every laser. Lasers only fly straight up, so a laser is its x, its y and its y at the end of the
+previous tick; its bounds are derived from those when needed. All slots are allocated once, live lasers are kept
+packed at the front of the arrays, and a removed laser is replaced by the last one (swap-remove) so the arrays never
+have holes and no memory is allocated or freed while playing.
+*/
+
+#pragma once
+
+#include "GameConstants.h"
+#include "StateStream.h"
+#include <vector>
+
+const size_t MAX_LASERS = 256; // Most lasers that can be in flight at once
+
+class LaserPool {
+public:
+    explicit LaserPool(size_t capacity = MAX_LASERS) : capacity(capacity) {
+        x.reserve(capacity);
+        y.reserve(capacity);
+        previousY.reserve(capacity);
+    }
+
+    /*
+    Fires a new laser if a slot is free.
+    - Input: size of the laser sprite, x and y of its starting position.
+    - Output: Returns false if every slot is in use and the shot was dropped.
+    */
+    bool spawn(Vec2f size, float startX, float startY) {
+        if (x.size() >= capacity) {
+            return false;
+        }
+        laserSize = size;
+        x.push_back(startX);
+        y.push_back(startY);
+        previousY.push_back(startY);
+        return true;
+    }
+
+    // - Input: deltaTime controls how much every laser moves up based on elapsed time, at speed pixels per second.
+    void update(float deltaTime, float speed) {
+        float step = speed * deltaTime;
+        for (size_t i = 0; i < y.size(); ++i) {
+            previousY[i] = y[i];
+            y[i] -= step;
+        }
+    }
+
+    /*
+    Removes the laser at index i by moving the last laser into its slot. When iterating, do not advance the index after
+    a removal since slot i now holds a laser that has not been visited yet.
+    */
+    void remove(size_t i) {
+        x[i] = x.back();
+        y[i] = y.back();
+        previousY[i] = previousY.back();
+        x.pop_back();
+        y.pop_back();
+        previousY.pop_back();
+    }
+
+    void clear() {
+        x.clear();
+        y.clear();
+        previousY.clear();
+    }
+
+    size_t size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+
+    // - Output: Returns true if laser i has moved off the top of the screen.
+    bool isOffScreen(size_t i) const {
+        return y[i] < 0;
+    }
+
+    // - Output: Returns the area covered by laser i.
+    FloatRect getGlobalBounds(size_t i) const {
+        return FloatRect(x[i], y[i], laserSize.x, laserSize.y);
+    }
+
+    // - Output: Returns the area covered by laser i at the start of the tick, for swept hit tests.
+    FloatRect getStartBounds(size_t i) const {
+        return FloatRect(x[i], previousY[i], laserSize.x, laserSize.y);
+    }
+
+    // - Output: Returns the movement of laser i over the last tick.
+    Vec2f getDisplacement(size_t i) const {
+        return Vec2f(0.f, y[i] - previousY[i]);
+    }
+
+    // - Output: Returns the position of laser i, interpolated between the previous and the current tick by alpha.
+    Vec2f getInterpolatedPosition(size_t i, float alpha) const {
+        return Vec2f(x[i], previousY[i] + (y[i] - previousY[i]) * alpha);
+    }
+
+    // - Input: writer receives every live laser.
+    void saveState(StateWriter& writer) const {
+        writer.write(laserSize);
+        writer.writeVector(x);
+        writer.writeVector(y);
+        writer.writeVector(previousY);
+    }
+
+    /*
+    Restores the lasers written by saveState().
+    - Input: reader positioned at the laser state.
+    - Output: Returns false if the state is cut short, the arrays differ in length or hold more lasers than the pool.
+    */
+    bool loadState(StateReader& reader) {
+        return reader.read(laserSize) && reader.readVector(x) && reader.readVector(y) && reader.readVector(previousY) &&
+               y.size() == x.size() && previousY.size() == x.size() && x.size() <= capacity;
+    }
+
+private:
+    size_t capacity;                     // Number of preallocated slots
+    Vec2f laserSize;                     // Size of every laser
+    std::vector<float> x;                // X coordinate of every live laser, packed; capacity is reserved up front
+    std::vector<float> y;                // Y coordinate of every live laser
+    std::vector<float> previousY;        // Y coordinates at the end of the previous tick
+};
@@ -0,0 +1,74 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the input-to-display latency monitor.
+*/
+
+#include "LatencyMonitor.h"
+#include <algorithm>
+
+LatencyMonitor::LatencyMonitor()
+    : pending(false), applied(false), historyIndex(0), historyCount(0), sampleCount(0), totalNanos(0), maxNanos(0) {}
+
+/*
+Starts measuring an input unless an older one is still waiting.
+- Input: time the input event was received.
+*/
+void LatencyMonitor::inputReceived(Clock::time_point time) {
+    if (!pending) {
+        pending = true;
+        pendingTime = time;
+    }
+}
+
+// Marks the waiting input as used by a simulation tick; called after every tick.
+void LatencyMonitor::inputApplied() {
+    if (pending && !applied) {
+        applied = true;
+        appliedTime = pendingTime;
+        pending = false;
+    }
+}
+
+/*
+Ends the measurement of an input used by a tick and stores its latency.
+- Input: time the display call returned.
+*/
+void LatencyMonitor::frameDisplayed(Clock::time_point time) {
+    if (!applied) {
+        return;
+    }
+    applied = false;
+    int64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(time - appliedTime).count();
+    history[historyIndex] = nanos;
+    historyIndex = (historyIndex + 1) % HISTORY_SAMPLES;
+    historyCount = std::min(historyCount + 1, HISTORY_SAMPLES);
+    ++sampleCount;
+    totalNanos += nanos;
+    maxNanos = std::max(maxNanos, nanos);
+}
+
+// - Output: Returns the latency statistics, all zero before the first sample.
+LatencyMonitor::Stats LatencyMonitor::getStats() const {
+    Stats stats = {sampleCount, 0.0, 0.0, 0.0, 0.0, 0.0};
+    if (historyCount == 0) {
+        return stats;
+    }
+    int64_t sorted[HISTORY_SAMPLES];
+    std::copy(history, history + historyCount, sorted);
+    int p99Index = std::max(0, (historyCount * 99 + 99) / 100 - 1);
+    std::nth_element(sorted, sorted + p99Index, sorted + historyCount);
+    int64_t total = 0;
+    for (int i = 0; i < historyCount; ++i) {
+        total += sorted[i];
+    }
+    stats.minMs = *std::min_element(sorted, sorted + historyCount) / 1e6;
+    stats.averageMs = total / 1e6 / historyCount;
+    stats.p99Ms = sorted[p99Index] / 1e6;
+    stats.sessionAverageMs = totalNanos / 1e6 / sampleCount;
+    stats.sessionMaxMs = maxNanos / 1e6;
+    return stats;
+}
@@ -0,0 +1,54 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The LatencyMonitor measures input-to-display latency: the time from a control key event to the return of the display
+call of the first frame drawn after a simulation tick used that input. An input is tracked through three steps,
+received, applied by a tick and displayed, so a frame that ran no tick does not end the measurement early. When
+several inputs arrive before a frame is displayed, the oldest one is measured. The latest samples are kept for min,
+average and 99th percentile, and the whole session for the count, average and maximum.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+class LatencyMonitor {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static constexpr int HISTORY_SAMPLES = 256; // Samples kept for the rolling statistics
+
+    // Latency statistics in milliseconds
+    struct Stats {
+        long long samples;     // Inputs measured in the whole session
+        double minMs;          // Over the rolling history
+        double averageMs;      // Over the rolling history
+        double p99Ms;          // Over the rolling history
+        double sessionAverageMs;
+        double sessionMaxMs;
+    };
+
+    LatencyMonitor();
+
+    void inputReceived(Clock::time_point time);
+    void inputApplied();
+    void frameDisplayed(Clock::time_point time);
+    Stats getStats() const;
+
+private:
+    bool pending;                     // An input was received but no tick has used it yet
+    Clock::time_point pendingTime;
+    bool applied;                     // An input was used by a tick but not displayed yet
+    Clock::time_point appliedTime;
+
+    int64_t history[HISTORY_SAMPLES]; // Latest samples in nanoseconds, used as a ring buffer
+    int historyIndex;                 // Next slot of the history ring buffer
+    int historyCount;                 // Number of samples stored, up to HISTORY_SAMPLES
+    long long sampleCount;
+    int64_t totalNanos;
+    int64_t maxNanos;
+};
@@ -0,0 +1,44 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Read-only memory mapping of a whole file. The contents are paged in by the operating system on first touch instead of
+being copied through a read buffer, and stay valid until the MappedFile is closed or destroyed.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    // - Output: Returns the first byte of the mapped file, or nullptr if no file is open.
+    const unsigned char* getData() const {
+        return data;
+    }
+
+    // - Output: Returns the size of the mapped file in bytes.
+    size_t getSize() const {
+        return size;
+    }
+
+private:
+    const unsigned char* data;
+    size_t size;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
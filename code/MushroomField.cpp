@@ -0,0 +1,176 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the cell-indexed mushroom field.
+*/
+
+#include "MushroomField.h"
+#include <algorithm>
+
+MushroomField::MushroomField() : cellSize(1.f, 1.f), columns(0), rows(0), count(0), revision(0) {}
+
+/*
+Sets the grid dimensions and removes every mushroom.
+- Input: cellSize is the size of one mushroom, columns and rows the size of the grid in cells.
+*/
+void MushroomField::resize(Vec2f cellSize, int columns, int rows) {
+    this->cellSize = cellSize;
+    this->columns = columns;
+    this->rows = rows;
+    health.assign(static_cast<size_t>(columns) * rows, 0);
+    count = 0;
+    ++revision;
+}
+
+// Removes every mushroom while keeping the grid dimensions.
+void MushroomField::clear() {
+    std::fill(health.begin(), health.end(), 0);
+    count = 0;
+    ++revision;
+}
+
+/*
+Places a full-health mushroom in a cell.
+- Input: column and row of the cell.
+- Output: Returns false if the cell is outside the grid or already holds a mushroom.
+*/
+bool MushroomField::place(int column, int row) {
+    if (column < 0 || column >= columns || row < 0 || row >= rows) {
+        return false;
+    }
+    uint8_t& cell = health[static_cast<size_t>(row) * columns + column];
+    if (cell != 0) {
+        return false;
+    }
+    cell = FULL_HEALTH;
+    ++count;
+    ++revision;
+    return true;
+}
+
+/*
+Finds the first mushroom, in row-major order, that overlaps a box. Only the cells under the box are visited.
+- Input: bounds is the box to test, cell receives the coordinates of the mushroom found.
+- Output: Returns true if a mushroom overlaps the box.
+*/
+bool MushroomField::findFirstOverlap(const FloatRect& bounds, MushroomCell& cell) const {
+    int firstColumn, firstRow, lastColumn, lastRow;
+    if (!getCellRange(bounds, firstColumn, firstRow, lastColumn, lastRow)) {
+        return false;
+    }
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        const uint8_t* line = &health[static_cast<size_t>(row) * columns];
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            if (line[column] != 0) {
+                cell = {column, row};
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+Finds the mushroom that a box moving in a straight line over one tick runs into first. Only the cells under the swept
+box are visited; when several mushrooms are reached at the same moment the first in row-major order is returned. With
+no displacement this finds the same mushroom as findFirstOverlap.
+- Input: bounds is the box at the start of the tick, displacement its movement over the tick, cell receives the
+  coordinates of the mushroom found and timeOfImpact the fraction of the tick at which it is reached.
+- Output: Returns true if the box reaches a mushroom during the tick.
+*/
+bool MushroomField::findFirstSweptOverlap(const FloatRect& bounds, Vec2f displacement, MushroomCell& cell, float& timeOfImpact) const {
+    int firstColumn, firstRow, lastColumn, lastRow;
+    if (!getCellRange(getSweptBounds(bounds, displacement), firstColumn, firstRow, lastColumn, lastRow)) {
+        return false;
+    }
+
+    bool found = false;
+    for (int row = firstRow; row <= lastRow; ++row) {
+        const uint8_t* line = &health[static_cast<size_t>(row) * columns];
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            float impact;
+            if (line[column] != 0 && sweepIntersects(bounds, displacement, getCellBounds(column, row), impact) &&
+                (!found || impact < timeOfImpact)) {
+                cell = {column, row};
+                timeOfImpact = impact;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+/*
+Applies one laser hit to a mushroom. A full mushroom becomes small, a small one is destroyed.
+- Input: cell holding the mushroom.
+- Output: Returns true if the hit destroyed the mushroom.
+*/
+bool MushroomField::hit(MushroomCell cell) {
+    uint8_t& value = health[static_cast<size_t>(cell.row) * columns + cell.column];
+    if (value == 0) {
+        return false;
+    }
+    ++revision;
+    if (--value == 0) {
+        --count;
+        return true;
+    }
+    return false;
+}
+
+// Removes the mushroom in a cell regardless of its health.
+void MushroomField::destroy(MushroomCell cell) {
+    uint8_t& value = health[static_cast<size_t>(cell.row) * columns + cell.column];
+    if (value != 0) {
+        value = 0;
+        --count;
+        ++revision;
+    }
+}
+
+/*
+Computes the range of cells that a box overlaps, clamped to the grid. Cells that the box only touches on an edge are
+excluded, matching the FloatRect overlap rule.
+- Output: Returns false if the box lies entirely outside the grid or has no area.
+*/
+bool MushroomField::getCellRange(const FloatRect& bounds, int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const {
+    if (bounds.width <= 0.f || bounds.height <= 0.f) {
+        return false;
+    }
+
+    firstColumn = std::max(0, static_cast<int>(std::floor(bounds.left / cellSize.x)));
+    firstRow = std::max(0, static_cast<int>(std::floor(bounds.top / cellSize.y)));
+    lastColumn = std::min(columns - 1, static_cast<int>(std::ceil((bounds.left + bounds.width) / cellSize.x)) - 1);
+    lastRow = std::min(rows - 1, static_cast<int>(std::ceil((bounds.top + bounds.height) / cellSize.y)) - 1);
+    return firstColumn <= lastColumn && firstRow <= lastRow;
+}
+
+// - Input: writer receives the grid layout and the health of every cell.
+void MushroomField::saveState(StateWriter& writer) const {
+    writer.write(cellSize);
+    writer.write(columns);
+    writer.write(rows);
+    writer.write<uint64_t>(count);
+    writer.writeVector(health);
+}
+
+/*
+Restores the grid written by saveState(), reusing the cell storage when the grid size is unchanged.
+- Input: reader positioned at the mushroom state.
+- Output: Returns false if the state is cut short or the cell count does not match the grid size.
+*/
+bool MushroomField::loadState(StateReader& reader) {
+    uint64_t mushroomCount = 0;
+    reader.read(cellSize);
+    reader.read(columns);
+    reader.read(rows);
+    reader.read(mushroomCount);
+    count = static_cast<size_t>(mushroomCount);
+    ++revision;
+    return reader.readVector(health) && columns >= 0 && rows >= 0 &&
+           health.size() == static_cast<size_t>(columns) * static_cast<size_t>(rows);
+}
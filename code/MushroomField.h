@@ -0,0 +1,71 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The MushroomField stores every mushroom in a grid of cells the size of one mushroom. Each cell holds the health of the
+mushroom in it (0 means empty), packed in one contiguous row-major array. Collision queries only look at the few cells
+under the queried box instead of walking every mushroom. A revision counter goes up with every change to the cells, so
+a renderer can tell in one comparison whether anything needs to be drawn again.
+*/
+
+#pragma once
+
+#include "GameMath.h"
+#include "StateStream.h"
+#include <cstdint>
+#include <vector>
+
+// Grid cell coordinates of a mushroom
+struct MushroomCell {
+    int column;
+    int row;
+};
+
+class MushroomField {
+public:
+    static constexpr uint8_t FULL_HEALTH = 2; // Hits needed to destroy a mushroom; health 1 is drawn as the small mushroom
+
+    MushroomField();
+
+    void resize(Vec2f cellSize, int columns, int rows);
+    void clear();
+    bool place(int column, int row);
+    bool findFirstOverlap(const FloatRect& bounds, MushroomCell& cell) const;
+    bool findFirstSweptOverlap(const FloatRect& bounds, Vec2f displacement, MushroomCell& cell, float& timeOfImpact) const;
+    bool hit(MushroomCell cell);
+    void destroy(MushroomCell cell);
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader);
+
+    // - Output: Returns the health of the mushroom in a cell, 0 if the cell is empty.
+    uint8_t getHealth(int column, int row) const {
+        return health[static_cast<size_t>(row) * columns + column];
+    }
+
+    // - Output: Returns the area covered by the mushroom in a cell.
+    FloatRect getCellBounds(int column, int row) const {
+        return FloatRect(column * cellSize.x, row * cellSize.y, cellSize.x, cellSize.y);
+    }
+
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+    Vec2f getCellSize() const { return cellSize; }
+
+    // - Output: Returns the number of mushrooms still standing.
+    size_t getCount() const { return count; }
+
+    // - Output: Returns a number that changes whenever any cell changes. It is not part of the saved state.
+    uint32_t getRevision() const { return revision; }
+
+private:
+    Vec2f cellSize;               // Size of one cell, equal to the mushroom sprite size
+    int columns;
+    int rows;
+    size_t count;                 // Number of non-empty cells
+    std::vector<uint8_t> health;  // Health per cell, row-major
+    uint32_t revision;            // Incremented on every change to the cells
+
+    bool getCellRange(const FloatRect& bounds, int& firstColumn, int& firstRow, int& lastColumn, int& lastRow) const;
+};
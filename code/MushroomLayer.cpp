@@ -0,0 +1,85 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Cached rendering of the mushroom field.
+*/
+
+#include "MushroomLayer.h"
+
+MushroomLayer::MushroomLayer(const TextureAtlas& atlas)
+    : changedSprites(atlas), erasedCells(sf::Quads), drawnColumns(0), drawnRows(0), drawnRevision(0),
+      drawn(false) {}
+
+/*
+Creates the off-screen texture, or recreates it when the world size changes. Needs the GL context of the window, so
+it is called once the window exists.
+- Input: width and height of the texture, the size of the play area.
+- Output: Returns false if the texture cannot be created.
+*/
+bool MushroomLayer::create(unsigned int width, unsigned int height) {
+    drawn = false;
+    return texture.create(width, height);
+}
+
+/*
+Brings the texture up to date with the field. Does nothing if the field has not changed since the last update.
+Changed cells are erased and redrawn without blending, so the texture holds the same pixels as drawing every mushroom
+onto a clear layer.
+- Input: mushrooms to show.
+*/
+void MushroomLayer::update(const MushroomField& mushrooms) {
+    if (drawn && mushrooms.getRevision() == drawnRevision && mushrooms.getColumns() == drawnColumns &&
+        mushrooms.getRows() == drawnRows) {
+        return;
+    }
+
+    // A new grid starts from a clear texture, so every standing mushroom counts as changed
+    if (!drawn || mushrooms.getColumns() != drawnColumns || mushrooms.getRows() != drawnRows) {
+        texture.clear(sf::Color::Transparent);
+        drawnColumns = mushrooms.getColumns();
+        drawnRows = mushrooms.getRows();
+        drawnHealth.assign(static_cast<size_t>(drawnColumns) * drawnRows, 0);
+        drawn = true;
+    }
+
+    erasedCells.clear();
+    changedSprites.clear();
+    for (int row = 0; row < drawnRows; ++row) {
+        for (int column = 0; column < drawnColumns; ++column) {
+            uint8_t health = mushrooms.getHealth(column, row);
+            uint8_t& drawnCell = drawnHealth[static_cast<size_t>(row) * drawnColumns + column];
+            if (health == drawnCell) {
+                continue;
+            }
+            FloatRect bounds = mushrooms.getCellBounds(column, row);
+            if (drawnCell != 0) {
+                sf::Vector2f topLeft(bounds.left, bounds.top);
+                sf::Vector2f bottomRight(bounds.left + bounds.width, bounds.top + bounds.height);
+                erasedCells.append(sf::Vertex(topLeft, sf::Color::Transparent));
+                erasedCells.append(sf::Vertex(sf::Vector2f(bottomRight.x, topLeft.y), sf::Color::Transparent));
+                erasedCells.append(sf::Vertex(bottomRight, sf::Color::Transparent));
+                erasedCells.append(sf::Vertex(sf::Vector2f(topLeft.x, bottomRight.y), sf::Color::Transparent));
+            }
+            if (health != 0) {
+                // A mushroom that was hit once is drawn small
+                changedSprites.add(health < MushroomField::FULL_HEALTH ? SPRITE_MUSHROOM_SMALL : SPRITE_MUSHROOM,
+                                   bounds.left, bounds.top);
+            }
+            drawnCell = health;
+        }
+    }
+
+    sf::RenderStates replace(sf::BlendNone);
+    texture.draw(erasedCells, replace);
+    texture.draw(changedSprites, replace);
+    texture.display();
+    drawnRevision = mushrooms.getRevision();
+}
+
+// Draws the cached layer as one textured quad.
+void MushroomLayer::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    target.draw(sf::Sprite(texture.getTexture()), states);
+}
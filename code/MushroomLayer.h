@@ -0,0 +1,39 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The MushroomLayer keeps the mushroom field rendered into an off-screen texture, which is drawn to the window as a
+single quad every frame. Mushrooms only change when they are hit, so the texture is left alone on most frames; when
+the field's revision changes, only the cells whose health differs from what was drawn are erased and drawn again.
+*/
+
+#pragma once
+
+#include "MushroomField.h"
+#include "SpriteBatch.h"
+#include "TextureAtlas.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+class MushroomLayer : public sf::Drawable {
+public:
+    explicit MushroomLayer(const TextureAtlas& atlas);
+
+    bool create(unsigned int width, unsigned int height);
+    void update(const MushroomField& mushrooms);
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    sf::RenderTexture texture;           // Every mushroom as last drawn
+    SpriteBatch changedSprites;          // Mushrooms drawn again in this update
+    sf::VertexArray erasedCells;         // Transparent quads over the cells that changed
+    std::vector<uint8_t> drawnHealth;    // Health of every cell as drawn in the texture
+    int drawnColumns;
+    int drawnRows;
+    uint32_t drawnRevision;              // Revision of the field the texture shows
+    bool drawn;                          // False until the first update
+};
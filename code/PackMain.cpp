@@ -0,0 +1,63 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Asset packer run at build time. It decodes every sprite PNG, packs the images into the atlas the game uses and writes
+the atlas pixels, the sprite rectangles and the font into one asset bundle, so the game does none of this at startup.
+
+Usage: centipede_pack GRAPHICS_DIR FONT_FILE OUTPUT
+Example:
+    centipede_pack graphics/ fonts/KOMIKAP.ttf assets.pak
+*/
+
+#include "AssetBundle.h"
+#include "TextureAtlas.h"
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage: centipede_pack GRAPHICS_DIR FONT_FILE OUTPUT" << std::endl;
+        return 1;
+    }
+    std::string directory = argv[1];
+    if (!directory.empty() && directory.back() != '/' && directory.back() != '\\') {
+        directory += '/';
+    }
+
+    sf::Image images[SPRITE_COUNT];
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        std::string path = directory + getSpriteFileName(static_cast<SpriteId>(i));
+        if (!images[i].loadFromFile(path)) {
+            std::cerr << "Could not load " << path << std::endl;
+            return 1;
+        }
+    }
+
+    sf::Image atlas;
+    sf::IntRect rects[SPRITE_COUNT];
+    if (!packAtlas(images, SPRITE_COUNT, atlas, rects)) {
+        std::cerr << "The sprites do not fit in one atlas" << std::endl;
+        return 1;
+    }
+
+    std::ifstream fontFile(argv[2], std::ios::binary);
+    if (!fontFile) {
+        std::cerr << "Could not load " << argv[2] << std::endl;
+        return 1;
+    }
+    std::vector<char> font((std::istreambuf_iterator<char>(fontFile)), std::istreambuf_iterator<char>());
+
+    if (!writeAssetBundle(argv[3], atlas, rects, font)) {
+        std::cerr << "Could not write " << argv[3] << std::endl;
+        return 1;
+    }
+    std::cout << "Packed " << SPRITE_COUNT << " sprites (" << atlas.getSize().x << "x" << atlas.getSize().y
+              << " atlas) and " << font.size() << " font bytes into " << argv[3] << std::endl;
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the per-phase frame profiler and its Chrome trace export.
+*/
+
+#include "Profiler.h"
+#include "AllocationCounter.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+// Small per-thread number used as the tid of trace events
+static uint32_t currentThreadIndex() {
+    static std::atomic<uint32_t> nextIndex(0);
+    thread_local uint32_t index = nextIndex++;
+    return index;
+}
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+// Phase 0 is the whole frame, measured from one endFrame() to the next.
+Profiler::Profiler()
+    : phaseCount(0), historyIndex(0), historyCount(0), lastAllocationCount(getAllocationCount().allocations),
+      enabled(false), tracing(false) {
+    registerPhase("frame");
+    std::fill(allocationHistory, allocationHistory + HISTORY_FRAMES, 0);
+    traceStart = lastFrame = Clock::now();
+}
+
+/*
+Returns the index of a phase, adding it the first time a name is seen. PROFILE_SCOPE calls this once per call site.
+- Input: name of the phase; it must stay valid for the life of the program (a string literal).
+- Output: Returns the phase index, or the last phase if MAX_PHASES names are already in use.
+*/
+int Profiler::registerPhase(const char* name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < phaseCount; ++i) {
+        if (std::strcmp(phases[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (phaseCount == MAX_PHASES) {
+        return MAX_PHASES - 1;
+    }
+    Phase& phase = phases[phaseCount];
+    phase.name = name;
+    phase.frameNanos.store(0);
+    std::fill(phase.history, phase.history + HISTORY_FRAMES, 0);
+    return phaseCount++;
+}
+
+/*
+Adds one timed block to a phase, and to the trace if one is being captured. Outside of a trace this only does an
+atomic add, so timers stay cheap enough to leave in release builds.
+- Input: phase index, start and end time of the block.
+*/
+void Profiler::record(int phase, Clock::time_point start, Clock::time_point end) {
+    int64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    phases[phase].frameNanos.fetch_add(nanos, std::memory_order_relaxed);
+    if (!tracing.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (tracing && events.size() < events.capacity()) {
+        TraceEvent event;
+        event.phase = phase;
+        event.startNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(start - traceStart).count();
+        event.durationNanos = nanos;
+        event.thread = currentThreadIndex();
+        events.push_back(event);
+    }
+}
+
+/*
+Closes the current frame: the time every phase spent in it and the number of heap allocations made since the last
+call are pushed into the rolling history, and the per-frame totals start again from zero.
+*/
+void Profiler::endFrame() {
+    std::lock_guard<std::mutex> lock(mutex);
+    Clock::time_point now = Clock::now();
+    phases[0].frameNanos.store(std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastFrame).count());
+    lastFrame = now;
+
+    for (int i = 0; i < phaseCount; ++i) {
+        phases[i].history[historyIndex] = phases[i].frameNanos.exchange(0);
+    }
+    uint64_t allocations = getAllocationCount().allocations;
+    allocationHistory[historyIndex] = static_cast<int64_t>(allocations - lastAllocationCount);
+    lastAllocationCount = allocations;
+    historyIndex = (historyIndex + 1) % HISTORY_FRAMES;
+    historyCount = std::min(historyCount + 1, HISTORY_FRAMES);
+}
+
+/*
+Computes min, average and 99th percentile of every phase over the frames in the history.
+- Input: stats receives up to maxStats entries, in the order the phases were first used.
+- Output: Returns the number of entries written.
+*/
+int Profiler::getStats(PhaseStats* stats, int maxStats) {
+    std::lock_guard<std::mutex> lock(mutex);
+    int count = std::min(phaseCount, maxStats);
+    for (int i = 0; i < count; ++i) {
+        const Phase& phase = phases[i];
+        stats[i].name = phase.name;
+        stats[i].minMs = stats[i].averageMs = stats[i].p99Ms = 0.0;
+        if (historyCount == 0) {
+            continue;
+        }
+
+        int64_t total = 0;
+        for (int f = 0; f < historyCount; ++f) {
+            sortScratch[f] = phase.history[f];
+            total += phase.history[f];
+        }
+        int p99Index = std::max(0, (historyCount * 99 + 99) / 100 - 1);
+        std::nth_element(sortScratch, sortScratch + p99Index, sortScratch + historyCount);
+        int64_t p99 = sortScratch[p99Index];
+        int64_t minimum = *std::min_element(sortScratch, sortScratch + historyCount);
+
+        stats[i].minMs = minimum / 1e6;
+        stats[i].averageMs = total / 1e6 / historyCount;
+        stats[i].p99Ms = p99 / 1e6;
+    }
+    return count;
+}
+
+// - Output: Returns the heap allocations of the last frame and their average and maximum over the history.
+Profiler::AllocationStats Profiler::getAllocationStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    AllocationStats stats = {0, 0.0, 0};
+    if (historyCount == 0) {
+        return stats;
+    }
+    int64_t total = 0;
+    for (int f = 0; f < historyCount; ++f) {
+        total += allocationHistory[f];
+        stats.max = std::max(stats.max, allocationHistory[f]);
+    }
+    stats.lastFrame = allocationHistory[(historyIndex + HISTORY_FRAMES - 1) % HISTORY_FRAMES];
+    stats.average = static_cast<double>(total) / historyCount;
+    return stats;
+}
+
+/*
+Enables the timers and starts capturing timed blocks as trace events. Storage for the events is reserved here; once it is full, later
+blocks are not stored.
+- Input: maxEvents is the most events kept.
+*/
+void Profiler::startTrace(size_t maxEvents) {
+    std::lock_guard<std::mutex> lock(mutex);
+    events.clear();
+    events.reserve(maxEvents);
+    traceStart = Clock::now();
+    tracing = true;
+    enabled = true;
+}
+
+/*
+Stops the capture and writes the events in the Chrome trace_event JSON format, with times in microseconds.
+- Input: path of the JSON file to write.
+- Output: Returns false if the file cannot be written.
+*/
+bool Profiler::writeTrace(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    tracing = false;
+
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    std::fprintf(file, "{\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        std::fprintf(file, "{\"name\":\"%s\",\"cat\":\"game\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}%s\n",
+                     phases[event.phase].name, event.startNanos / 1000.0, event.durationNanos / 1000.0, event.thread,
+                     i + 1 < events.size() ? "," : "");
+    }
+    std::fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+    return std::fclose(file) == 0;
+}
@@ -0,0 +1,139 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Per-phase frame profiler. PROFILE_SCOPE("name") times the enclosing block and adds it to the phase of that name. At
+every endFrame() the time each phase spent in the frame is pushed into a rolling history, from which min, average and
+99th percentile are reported. While a trace is being captured every timed block is also stored as a Chrome trace_event
+and can be written to a JSON file for chrome://tracing or Perfetto. When allocation tracking is compiled in (see
+AllocationCounter.h) the number of heap allocations made in each frame is kept in the same history.
+
+Profiling is compiled in when CENTIPEDE_PROFILING is defined (the default CMake setting); otherwise PROFILE_SCOPE
+expands to nothing. Compiled-in timers still do nothing until setEnabled(true) is called, so tools that measure raw
+throughput pay only for one flag test per scope.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Profiler {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    static constexpr int MAX_PHASES = 32;     // Most distinct phase names
+    static constexpr int HISTORY_FRAMES = 240; // Frames kept for the rolling statistics
+
+    // Rolling statistics of one phase, in milliseconds per frame
+    struct PhaseStats {
+        const char* name;
+        double minMs;
+        double averageMs;
+        double p99Ms;
+    };
+
+    // Heap allocations per frame over the history; all zero without allocation tracking
+    struct AllocationStats {
+        int64_t lastFrame;
+        double average;
+        int64_t max;
+    };
+
+    static Profiler& instance();
+
+    int registerPhase(const char* name);
+    void record(int phase, Clock::time_point start, Clock::time_point end);
+    void endFrame();
+    int getStats(PhaseStats* stats, int maxStats);
+    AllocationStats getAllocationStats();
+
+    void startTrace(size_t maxEvents);
+    bool writeTrace(const std::string& path);
+
+    // Turns the timers on or off; off by default.
+    void setEnabled(bool on) {
+        enabled.store(on, std::memory_order_relaxed);
+    }
+
+    // - Output: Returns true while PROFILE_SCOPE timers are measuring.
+    bool isEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    // - Output: Returns true while timed blocks are being stored as trace events.
+    bool isTracing() const {
+        return tracing;
+    }
+
+private:
+    // One completed timed block, stored for the Chrome trace
+    struct TraceEvent {
+        int phase;
+        int64_t startNanos;            // From the start of the trace
+        int64_t durationNanos;
+        uint32_t thread;
+    };
+
+    // Timing data of one phase
+    struct Phase {
+        const char* name;
+        std::atomic<int64_t> frameNanos; // Time spent in the phase during the current frame
+        int64_t history[HISTORY_FRAMES]; // Per-frame totals, used as a ring buffer
+    };
+
+    Profiler();
+
+    std::mutex mutex;                  // Guards everything but the per-frame totals, which are atomic
+    Phase phases[MAX_PHASES];
+    int phaseCount;
+    int historyIndex;                  // Next slot of the history ring buffer
+    int historyCount;                  // Number of frames stored, up to HISTORY_FRAMES
+    int64_t sortScratch[HISTORY_FRAMES];
+    int64_t allocationHistory[HISTORY_FRAMES]; // Heap allocations made in each frame
+    uint64_t lastAllocationCount;      // Allocation total at the previous endFrame()
+
+    std::atomic<bool> enabled;
+    std::atomic<bool> tracing;
+    Clock::time_point traceStart;
+    Clock::time_point lastFrame;       // Time of the previous endFrame()
+    std::vector<TraceEvent> events;    // Capacity reserved when the trace starts
+};
+
+// Times the block it is declared in and adds the time to one phase of the profiler, if the profiler is enabled
+class ScopedTimer {
+public:
+    explicit ScopedTimer(int phase) : phase(phase) {
+        if (!Profiler::instance().isEnabled()) {
+            this->phase = -1;
+            return;
+        }
+        start = Profiler::Clock::now();
+    }
+    ~ScopedTimer() {
+        if (phase >= 0) {
+            Profiler::instance().record(phase, start, Profiler::Clock::now());
+        }
+    }
+
+private:
+    int phase;
+    Profiler::Clock::time_point start;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#ifdef CENTIPEDE_PROFILING
+#define PROFILE_SCOPE(name) \
+    static const int PROFILE_CONCAT(profilePhase, __LINE__) = Profiler::instance().registerPhase(name); \
+    ScopedTimer PROFILE_CONCAT(profileTimer, __LINE__)(PROFILE_CONCAT(profilePhase, __LINE__))
+#else
+#define PROFILE_SCOPE(name)
+#endif
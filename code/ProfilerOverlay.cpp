@@ -0,0 +1,77 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the profiler overlay.
+*/
+
+#include "ProfilerOverlay.h"
+#include "AllocationCounter.h"
+#include "Profiler.h"
+#include <cstdio>
+
+/*
+Creates a hidden overlay in the top left corner, below the score.
+- Input: font used for the table text.
+*/
+ProfilerOverlay::ProfilerOverlay(const sf::Font& font) : visible(false), refreshTimer(0.f), latencyMonitor(nullptr) {
+    text.setFont(font);
+    text.setCharacterSize(14);
+    text.setFillColor(sf::Color::Yellow);
+    text.setPosition(14.f, 48.f);
+    background.setFillColor(sf::Color(0, 0, 0, 180));
+    background.setPosition(10.f, 44.f);
+}
+
+/*
+Rebuilds the table text from the profiler a few times per second, so the numbers stay readable and the overlay does
+not add noticeable work to the frames it measures.
+- Input: deltaTime is the real time since the last call, in seconds.
+*/
+void ProfilerOverlay::update(float deltaTime) {
+    if (!visible) {
+        return;
+    }
+    refreshTimer += deltaTime;
+    if (refreshTimer < REFRESH_INTERVAL) {
+        return;
+    }
+    refreshTimer = 0.f;
+
+    Profiler::PhaseStats stats[Profiler::MAX_PHASES];
+    int count = Profiler::instance().getStats(stats, Profiler::MAX_PHASES);
+
+    char buffer[64 * (Profiler::MAX_PHASES + 3)];
+    int length = std::snprintf(buffer, sizeof(buffer), "%-24s %7s %7s %7s\n", "phase (ms)", "min", "avg", "p99");
+    for (int i = 0; i < count && length < static_cast<int>(sizeof(buffer)); ++i) {
+        length += std::snprintf(buffer + length, sizeof(buffer) - length, "%-24s %7.3f %7.3f %7.3f\n", stats[i].name,
+                                stats[i].minMs, stats[i].averageMs, stats[i].p99Ms);
+    }
+    int lines = count + 1;
+    if (latencyMonitor != nullptr && length < static_cast<int>(sizeof(buffer))) {
+        LatencyMonitor::Stats latency = latencyMonitor->getStats();
+        length += std::snprintf(buffer + length, sizeof(buffer) - length, "%-24s %7.3f %7.3f %7.3f\n",
+                                "input to display", latency.minMs, latency.averageMs, latency.p99Ms);
+        ++lines;
+    }
+    if (isAllocationTrackingEnabled() && length < static_cast<int>(sizeof(buffer))) {
+        Profiler::AllocationStats allocations = Profiler::instance().getAllocationStats();
+        length += std::snprintf(buffer + length, sizeof(buffer) - length, "%-24s %7lld %7.1f %7lld\n",
+                                "allocs last/avg/max", static_cast<long long>(allocations.lastFrame),
+                                allocations.average, static_cast<long long>(allocations.max));
+        ++lines;
+    }
+    text.setString(buffer);
+    background.setSize(sf::Vector2f(460.f, 8.f + 18.f * lines));
+}
+
+// Draws the table over whatever is already in the target.
+void ProfilerOverlay::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (!visible) {
+        return;
+    }
+    target.draw(background, states);
+    target.draw(text, states);
+}
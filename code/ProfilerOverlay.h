@@ -0,0 +1,50 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+On-screen table of the profiler statistics: one line per phase with the rolling min, average and 99th percentile time
+per frame. With a latency monitor attached, a line shows the input-to-display latency, and with allocation tracking
+compiled in a last line shows the heap allocations of the last frame and their average and maximum. It is toggled with
+F3 in the game and drawn over the world with the game font.
+*/
+
+#pragma once
+
+#include "LatencyMonitor.h"
+#include <SFML/Graphics.hpp>
+
+class ProfilerOverlay : public sf::Drawable {
+public:
+    explicit ProfilerOverlay(const sf::Font& font);
+
+    void update(float deltaTime);
+
+    // Shows the overlay if it is hidden and hides it if it is shown.
+    void toggle() {
+        visible = !visible;
+        refreshTimer = REFRESH_INTERVAL; // Fill the table on the next update
+    }
+
+    // - Input: monitor whose latency is shown below the phases, nullptr for none. It must outlive the overlay.
+    void setLatencyMonitor(const LatencyMonitor* monitor) {
+        latencyMonitor = monitor;
+    }
+
+    // - Output: Returns true while the overlay is drawn.
+    bool isVisible() const {
+        return visible;
+    }
+
+private:
+    static constexpr float REFRESH_INTERVAL = 0.25f; // Seconds between refreshes of the table text
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    sf::Text text;
+    sf::RectangleShape background;
+    bool visible;
+    float refreshTimer;
+    const LatencyMonitor* latencyMonitor; // Not owned
+};
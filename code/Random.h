@@ -0,0 +1,65 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+PCG32 random number generator (permuted congruential generator, XSH RR variant). Every random draw of the simulation
+goes through one of these owned by the GameWorld, so a game is fully determined by its seed and its inputs. Unlike
+rand() it has no hidden global state, and unlike the std distributions its output is the same with every standard
+library, so recordings replay identically on every platform.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+class Pcg32 {
+public:
+    explicit Pcg32(uint64_t seed = 0, uint64_t stream = 0) {
+        this->seed(seed, stream);
+    }
+
+    /*
+    Restarts the generator.
+    - Input: seed selects the starting point, stream selects one of 2^63 independent sequences.
+    */
+    void seed(uint64_t seed, uint64_t stream = 0) {
+        state = 0;
+        increment = (stream << 1u) | 1u;
+        next();
+        state += seed;
+        next();
+    }
+
+    // - Output: Returns the next 32 random bits.
+    uint32_t next() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+        uint32_t xorShifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rotation = static_cast<uint32_t>(old >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+    }
+
+    /*
+    Draws a number in [0, bound) without modulo bias: draws below 2^32 % bound are rejected.
+    - Input: bound, at least 1.
+    */
+    uint32_t nextBelow(uint32_t bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        for (;;) {
+            uint32_t value = next();
+            if (value >= threshold) {
+                return value % bound;
+            }
+        }
+    }
+
+    // - Output: Returns a number in [low, high], both included.
+    int nextInt(int low, int high) {
+        return low + static_cast<int>(nextBelow(static_cast<uint32_t>(high - low) + 1u));
+    }
+
+    uint64_t state;      // Advances with every draw
+    uint64_t increment;  // Fixed per stream, always odd
+};
@@ -0,0 +1,56 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Capture of the render state of a GameWorld.
+*/
+
+#include "RenderSnapshot.h"
+
+RenderSnapshot::RenderSnapshot() : score(0), lives(0), gameOver(false), youWin(false), inputTicks(0) {}
+
+/*
+Copies the render state of the world after a tick. The first segment of every centipede is its head.
+- Input: world to copy from; it must not be stepped during the call.
+*/
+void RenderSnapshot::capture(const GameWorld& world) {
+    centipedeHeads.clear();
+    centipedeBodies.clear();
+    const SegmentArena& arena = world.segments;
+    for (const auto& centipede : world.centipedes) {
+        for (size_t i = 0; i < centipede.getSegmentCount(); ++i) {
+            size_t index = centipede.getFirstIndex() + i;
+            RenderEntity segment = {Vec2f(arena.previousX[index], arena.previousY[index]),
+                                    Vec2f(arena.x[index], arena.y[index])};
+            (i == 0 ? centipedeHeads : centipedeBodies).push_back(segment);
+        }
+    }
+
+    spiders.clear();
+    for (const auto& spider : world.spiders) {
+        if (spider.getIsAlive()) {
+            spiders.push_back({spider.previousPosition, spider.position});
+        }
+    }
+
+    // Interpolating at 0 and 1 gives the previous and current positions
+    lasers.clear();
+    for (size_t i = 0; i < world.lasers.size(); ++i) {
+        lasers.push_back({world.lasers.getInterpolatedPosition(i, 0.f), world.lasers.getInterpolatedPosition(i, 1.f)});
+    }
+
+    spaceship = {world.previousSpaceshipPosition, world.spaceshipPosition};
+
+    // The revision only ever goes up, so an equal revision means the copy is current
+    if (mushrooms.getRevision() != world.mushrooms.getRevision()) {
+        mushrooms = world.mushrooms;
+    }
+
+    worldSize = world.config.getWorldSize();
+    score = world.score;
+    lives = world.lives;
+    gameOver = world.gameOver;
+    youWin = world.youWin;
+}
@@ -0,0 +1,50 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Everything the renderer needs from one simulation tick: the previous and current position of every moving entity,
+the mushroom field, the world size and the HUD values. The simulation thread captures one after its ticks and
+publishes it through a TripleBuffer, and the render thread draws the latest one without touching the GameWorld.
+Storage is reused between captures, so once a snapshot has grown to the size of the game capturing allocates nothing,
+and the mushroom field is only copied when it changed.
+*/
+
+#pragma once
+
+#include "GameWorld.h"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// An entity to draw between its position at the end of the previous tick and at the end of the latest one
+struct RenderEntity {
+    Vec2f previous;
+    Vec2f current;
+};
+
+class RenderSnapshot {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    RenderSnapshot();
+
+    void capture(const GameWorld& world);
+
+    std::vector<RenderEntity> centipedeHeads;
+    std::vector<RenderEntity> centipedeBodies;
+    std::vector<RenderEntity> spiders;     // Living spiders only
+    std::vector<RenderEntity> lasers;
+    RenderEntity spaceship;
+    MushroomField mushrooms;
+    Vec2f worldSize;                       // Changes when a quick load brings back a game of another level
+    int score;
+    int lives;
+    bool gameOver;
+    bool youWin;
+
+    // Set by the simulation thread
+    Clock::time_point tickEnd;             // Real time the latest tick ended at, for interpolation
+    uint64_t inputTicks;                   // Ticks so far that applied key events, for latency measurement
+};
@@ -0,0 +1,82 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The SegmentArena holds the positions of every centipede segment in the world as packed x and y arrays. A centipede only
+owns an index range [first, first + count) of the arena, so removing a head or tail segment or splitting a centipede in
+two just changes index ranges: no segment data is copied and no memory is allocated. Slots left behind by destroyed
+segments are reclaimed when the arena is cleared for a new game.
+*/
+
+#pragma once
+
+#include "StateStream.h"
+#include <cstddef>
+#include <vector>
+
+class SegmentArena {
+public:
+    /*
+    Reserves room for a number of segments so later allocations up to that size do not reallocate.
+    - Input: capacity in segments.
+    */
+    void reserve(size_t capacity) {
+        x.reserve(capacity);
+        y.reserve(capacity);
+        previousX.reserve(capacity);
+        previousY.reserve(capacity);
+    }
+
+    /*
+    Appends a block of segments at the end of the arena.
+    - Input: count of segments to add.
+    - Output: Returns the index of the first segment of the block.
+    */
+    size_t allocate(size_t count) {
+        size_t first = x.size();
+        x.resize(first + count);
+        y.resize(first + count);
+        previousX.resize(first + count);
+        previousY.resize(first + count);
+        return first;
+    }
+
+    // Removes every segment, keeping the reserved memory.
+    void clear() {
+        x.clear();
+        y.clear();
+        previousX.clear();
+        previousY.clear();
+    }
+
+    // - Output: Returns the number of segment slots in use, including slots of destroyed segments.
+    size_t size() const {
+        return x.size();
+    }
+
+    // - Input: writer receives every segment slot.
+    void saveState(StateWriter& writer) const {
+        writer.writeVector(x);
+        writer.writeVector(y);
+        writer.writeVector(previousX);
+        writer.writeVector(previousY);
+    }
+
+    /*
+    Restores every segment slot written by saveState(), reusing the reserved memory.
+    - Input: reader positioned at the arena state.
+    - Output: Returns false if the state is cut short or the arrays differ in length.
+    */
+    bool loadState(StateReader& reader) {
+        return reader.readVector(x) && reader.readVector(y) && reader.readVector(previousX) &&
+               reader.readVector(previousY) && y.size() == x.size() && previousX.size() == x.size() &&
+               previousY.size() == x.size();
+    }
+
+    std::vector<float> x;          // X coordinate of every segment
+    std::vector<float> y;          // Y coordinate of every segment
+    std::vector<float> previousX;  // X coordinates at the end of the previous tick, for render interpolation
+    std::vector<float> previousY;  // Y coordinates at the end of the previous tick, for render interpolation
+};
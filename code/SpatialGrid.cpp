@@ -0,0 +1,92 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the uniform grid broadphase.
+*/
+
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid() : cellSize(1.f), columns(1), rows(1), cellStart(2, 0) {}
+
+/*
+Sets the area covered by the grid and removes every object.
+- Input: width and height of the area, cellSize is the side of one square cell.
+*/
+void SpatialGrid::resize(float width, float height, float cellSize) {
+    this->cellSize = cellSize;
+    columns = std::max(1, static_cast<int>(std::ceil(width / cellSize)));
+    rows = std::max(1, static_cast<int>(std::ceil(height / cellSize)));
+    cellStart.assign(static_cast<size_t>(columns) * rows + 1, 0);
+    clear();
+}
+
+// Removes every object, keeping the storage for the next build.
+void SpatialGrid::clear() {
+    entries.clear();
+    cellItems.clear();
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+}
+
+/*
+Adds an object for the next build().
+- Input: id handed back by query(), bounds covered by the object during the tick.
+*/
+void SpatialGrid::add(uint32_t id, const FloatRect& bounds) {
+    entries.push_back({id, getCellRange(bounds)});
+}
+
+/*
+Sorts the added objects into the cells: count the ids per cell, turn the counts into start offsets, then place every
+id. Ids of one cell keep the order they were added in.
+*/
+void SpatialGrid::build() {
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    size_t total = 0;
+    for (const Entry& entry : entries) {
+        const CellRange& r = entry.range;
+        for (int row = r.firstRow; row <= r.lastRow; ++row) {
+            for (int column = r.firstColumn; column <= r.lastColumn; ++column) {
+                ++cellStart[static_cast<size_t>(row) * columns + column + 1];
+                ++total;
+            }
+        }
+    }
+    for (size_t cell = 1; cell < cellStart.size(); ++cell) {
+        cellStart[cell] += cellStart[cell - 1];
+    }
+
+    // cellStart[cell] is used as the insertion point of the cell and ends up at the start of the next cell, so the
+    // offsets are shifted back by one cell afterwards
+    cellItems.resize(total);
+    for (const Entry& entry : entries) {
+        const CellRange& r = entry.range;
+        for (int row = r.firstRow; row <= r.lastRow; ++row) {
+            for (int column = r.firstColumn; column <= r.lastColumn; ++column) {
+                cellItems[cellStart[static_cast<size_t>(row) * columns + column]++] = entry.id;
+            }
+        }
+    }
+    for (size_t cell = cellStart.size() - 1; cell > 0; --cell) {
+        cellStart[cell] = cellStart[cell - 1];
+    }
+    cellStart[0] = 0;
+}
+
+/*
+Computes the cells covered by a box, clamped to the grid so boxes partly or fully outside still land in border cells.
+*/
+SpatialGrid::CellRange SpatialGrid::getCellRange(const FloatRect& bounds) const {
+    auto clampColumn = [&](float x) {
+        return std::min(columns - 1, std::max(0, static_cast<int>(std::floor(x / cellSize))));
+    };
+    auto clampRow = [&](float y) {
+        return std::min(rows - 1, std::max(0, static_cast<int>(std::floor(y / cellSize))));
+    };
+    return {clampColumn(bounds.left), clampRow(bounds.top), clampColumn(bounds.left + bounds.width),
+            clampRow(bounds.top + bounds.height)};
+}
@@ -0,0 +1,70 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Uniform grid broadphase for moving objects. Every tick the boxes of the objects are added with an id, build() sorts the
+ids into per-cell lists with a counting sort, and query() hands out the ids stored in the cells under a box as
+candidate pairs for the exact tests. Boxes outside the grid area are clamped to the border cells, so nothing is ever
+missed, only tested more often. Storage is kept between builds, so rebuilding every tick does not allocate once the
+object count has settled.
+*/
+
+#pragma once
+
+#include "GameMath.h"
+#include <cstdint>
+#include <vector>
+
+class SpatialGrid {
+public:
+    SpatialGrid();
+
+    void resize(float width, float height, float cellSize);
+    void clear();
+    void add(uint32_t id, const FloatRect& bounds);
+    void build();
+
+    /*
+    Calls visit(id) for every object stored in a cell under bounds. An object that covers several of those cells is
+    visited once per cell, so visit must not count on seeing an id once.
+    - Input: bounds to look under, visit is called with each candidate id.
+    */
+    template <typename Visit>
+    void query(const FloatRect& bounds, const Visit& visit) const {
+        CellRange range = getCellRange(bounds);
+        for (int row = range.firstRow; row <= range.lastRow; ++row) {
+            for (int column = range.firstColumn; column <= range.lastColumn; ++column) {
+                size_t cell = static_cast<size_t>(row) * columns + column;
+                for (uint32_t i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                    visit(cellItems[i]);
+                }
+            }
+        }
+    }
+
+private:
+    // Cells covered by a box, clamped to the grid
+    struct CellRange {
+        int firstColumn;
+        int firstRow;
+        int lastColumn;
+        int lastRow;
+    };
+
+    // One added object, kept until build() sorts it into the cells
+    struct Entry {
+        uint32_t id;
+        CellRange range;
+    };
+
+    CellRange getCellRange(const FloatRect& bounds) const;
+
+    float cellSize;
+    int columns;
+    int rows;
+    std::vector<Entry> entries;
+    std::vector<uint32_t> cellStart;   // Start of each cell's ids in cellItems, plus one end marker
+    std::vector<uint32_t> cellItems;   // Ids sorted by cell
+};
@@ -0,0 +1,126 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Movement and collision logic of the spider enemy.
+*/
+
+#include "Spider.h"
+
+/*
+Creates a dead spider, to be filled in by loadState().
+*/
+Spider::Spider() : worldSize(SCREEN_WIDTH, SCREEN_HEIGHT), isAlive(false) {}
+
+/*
+Represents a spider in the game. It moves in a random direction on the screen
+and can collide with mushrooms, the player's spaceship, or get shot by a laser.
+- Input: size: The size of the spider sprite, worldSize: the size of the world, random: generator for the start
+  position (in the upper half of the world) and direction.
+*/
+Spider::Spider(Vec2f size, Vec2f worldSize, Pcg32& random) : size(size), worldSize(worldSize) {
+    float x = static_cast<float>(random.nextBelow(static_cast<uint32_t>(worldSize.x)));
+    float y = static_cast<float>(random.nextBelow(static_cast<uint32_t>(worldSize.y) / 2));
+    float directionX = random.nextBelow(2) ? 1.f : -1.f;
+    float directionY = random.nextBelow(2) ? 1.f : -1.f;
+    position = Vec2f(x, y);
+    direction = Vec2f(directionX, directionY);
+    previousPosition = position;
+    isAlive = true;
+}
+
+/*
+Update the spider's position based on the direction it is moving.
+Changes direction if it hits the boundaries of the screen.
+- Input: deltaTime controls how much the spider moves based on the time passed since the last update, speed is in
+  pixels per second.
+*/
+void Spider::update(float deltaTime, float speed) {
+    previousPosition = position;
+    if (isAlive) {
+        position += direction * speed * deltaTime;
+
+        // Change direction if hitting boundaries
+        if (position.x <= 0 || position.x + size.x >= worldSize.x) {
+            direction.x = -direction.x;
+        }
+        if (position.y <= 0 || position.y + size.y >= worldSize.y) {
+            direction.y = -direction.y;
+        }
+    }
+}
+
+/*
+Checks if the spider has collided with a mushroom along its movement this tick.
+If there is a collision, the first mushroom it ran into is destroyed.
+- Input: mushrooms is the mushroom field to check for collisions.
+- Output: Returns true if a mushroom is destroyed.
+*/
+bool Spider::checkMushroomCollision(MushroomField& mushrooms) {
+    MushroomCell cell;
+    float impact;
+    if (isAlive && mushrooms.findFirstSweptOverlap(FloatRect(previousPosition, size), position - previousPosition, cell, impact)) {
+        mushrooms.destroy(cell);
+        return true; // Destroy mushroom on collision
+    }
+    return false;
+}
+
+/*
+Check if the spider collides with the player's spaceship at any point of the tick, using a swept test on their
+relative movement.
+- Input: spaceshipStart is the area covered by the spaceship at the start of the tick, spaceshipDisplacement its
+  movement over the tick.
+- Output: Returns true if the spider collides with the spaceship, false otherwise.
+*/
+bool Spider::checkSpaceshipCollision(const FloatRect& spaceshipStart, Vec2f spaceshipDisplacement) const {
+    float impact;
+    return isAlive && sweepIntersects(FloatRect(previousPosition, size), position - previousPosition - spaceshipDisplacement,
+                                      spaceshipStart, impact);
+}
+
+/*
+Check if a laser runs into the spider during the tick, using a swept test on their relative movement.
+- Input: laserStart is the area covered by the laser at the start of the tick, laserDisplacement its movement over the
+  tick, timeOfImpact receives the fraction of the tick at which the laser reaches the spider.
+- Output: Returns true if the spider is hit by the laser.
+*/
+bool Spider::findLaserHit(const FloatRect& laserStart, Vec2f laserDisplacement, float& timeOfImpact) const {
+    return isAlive && sweepIntersects(laserStart, laserDisplacement - (position - previousPosition),
+                                      FloatRect(previousPosition, size), timeOfImpact);
+}
+
+/*
+Kills the spider after a laser hit and increments the score. The world schedules its respawn.
+- Input: score is the player's score to be updated.
+*/
+void Spider::hitByLaser(int& score) {
+    isAlive = false;
+    score += 300; // Increment score by 300 when hitting the spider
+}
+
+// - Input: writer receives the spider state.
+void Spider::saveState(StateWriter& writer) const {
+    writer.write(position);
+    writer.write(previousPosition);
+    writer.write(size);
+    writer.write(worldSize);
+    writer.write(direction);
+    writer.write(isAlive);
+}
+
+/*
+Restores the spider state written by saveState().
+- Input: reader positioned at the spider state.
+- Output: Returns false if the state is cut short.
+*/
+bool Spider::loadState(StateReader& reader) {
+    reader.read(position);
+    reader.read(previousPosition);
+    reader.read(size);
+    reader.read(worldSize);
+    reader.read(direction);
+    return reader.read(isAlive);
+}
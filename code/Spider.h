@@ -0,0 +1,65 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Declaration of the randomly moving spider enemy.
+*/
+
+#pragma once
+
+#include "GameConstants.h"
+#include "MushroomField.h"
+#include "Random.h"
+#include "StateStream.h"
+
+// Spider class for randomly moving spider
+class Spider {
+public:
+    Spider();
+    Spider(Vec2f size, Vec2f worldSize, Pcg32& random);
+
+    void update(float deltaTime, float speed);
+    bool checkMushroomCollision(MushroomField& mushrooms);
+    bool checkSpaceshipCollision(const FloatRect& spaceshipStart, Vec2f spaceshipDisplacement) const;
+    bool findLaserHit(const FloatRect& laserStart, Vec2f laserDisplacement, float& timeOfImpact) const;
+    void hitByLaser(int& score);
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader);
+
+    /*
+    Set the alive state of the spider.
+    - Input: alive, which is either true (alive) or false (not alive).
+    */
+    void setIsAlive(bool alive) {
+        isAlive = alive;
+    }
+
+    /*
+    Get the current alive state of the spider.
+    - Output: Returns true if the spider is alive, false otherwise.
+    */
+    bool getIsAlive() const {
+        return isAlive;
+    }
+
+    // - Output: Returns the area covered by the spider.
+    FloatRect getGlobalBounds() const {
+        return FloatRect(position, size);
+    }
+
+    // - Output: Returns the area the spider covers while it moves from its previous to its current position.
+    FloatRect getSweptGlobalBounds() const {
+        return getSweptBounds(FloatRect(previousPosition, size), position - previousPosition);
+    }
+
+    Vec2f position;
+    Vec2f previousPosition;  // Position at the end of the previous tick, for render interpolation
+    Vec2f size;
+
+private:
+    Vec2f worldSize; // Size of the world the spider bounces around in
+    Vec2f direction; // Direction of movement
+    bool isAlive;    // State of the spider; a killed spider is brought back by the world's respawn timer
+};
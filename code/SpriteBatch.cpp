@@ -0,0 +1,38 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Quad batching for atlas sprites.
+*/
+
+#include "SpriteBatch.h"
+
+SpriteBatch::SpriteBatch(const TextureAtlas& atlas) : atlas(atlas), vertices(sf::Quads) {}
+
+/*
+Appends one sprite to the batch.
+- Input: id of the sprite in the atlas, x and y of its top-left corner on screen.
+*/
+void SpriteBatch::add(SpriteId id, float x, float y) {
+    const sf::IntRect& rect = atlas.getRect(id);
+    float width = static_cast<float>(rect.width);
+    float height = static_cast<float>(rect.height);
+    float u = static_cast<float>(rect.left);
+    float v = static_cast<float>(rect.top);
+
+    vertices.append(sf::Vertex(sf::Vector2f(x, y), sf::Vector2f(u, v)));
+    vertices.append(sf::Vertex(sf::Vector2f(x + width, y), sf::Vector2f(u + width, v)));
+    vertices.append(sf::Vertex(sf::Vector2f(x + width, y + height), sf::Vector2f(u + width, v + height)));
+    vertices.append(sf::Vertex(sf::Vector2f(x, y + height), sf::Vector2f(u, v + height)));
+}
+
+// Draws every quad of the batch in one call with the atlas texture bound.
+void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (vertices.getVertexCount() == 0) {
+        return;
+    }
+    states.texture = &atlas.getTexture();
+    target.draw(vertices, states);
+}
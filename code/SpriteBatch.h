@@ -0,0 +1,32 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+A SpriteBatch collects the sprites of one render layer as textured quads in a single sf::VertexArray, so the whole layer
+is drawn with one draw call and one bind of the atlas texture.
+*/
+
+#pragma once
+
+#include "TextureAtlas.h"
+#include <SFML/Graphics.hpp>
+
+class SpriteBatch : public sf::Drawable {
+public:
+    explicit SpriteBatch(const TextureAtlas& atlas);
+
+    // Removes every quad; the vertex storage is kept so refilling the batch each frame does not allocate.
+    void clear() {
+        vertices.clear();
+    }
+
+    void add(SpriteId id, float x, float y);
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    const TextureAtlas& atlas;
+    sf::VertexArray vertices;
+};
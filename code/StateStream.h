@@ -0,0 +1,132 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Byte streams for the simulation state. StateWriter appends plain values and arrays to a byte buffer that is kept
+between uses and StateReader reads them back in the same order, stopping at the end of the buffer instead of reading
+past it. Values are copied as they are laid out in memory, so the bytes are only meant to be read by the same build on
+the same kind of machine. hashBytes() turns a buffer into a 64-bit FNV-1a hash, used to compare two runs of the
+simulation.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+class StateWriter {
+public:
+    // - Input: value to append; must be a plain value that can be copied byte by byte.
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written");
+        writeBytes(&value, sizeof(T));
+    }
+
+    // - Input: values to append, preceded by their count.
+    template <typename T>
+    void writeVector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written");
+        write<uint64_t>(values.size());
+        writeBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    void writeBytes(const void* data, size_t size) {
+        if (used + size > bytes.size()) {
+            bytes.resize(std::max(used + size, 2 * bytes.size()));
+        }
+        if (size != 0) {
+            std::memcpy(bytes.data() + used, data, size);
+        }
+        used += size;
+    }
+
+    // Empties the buffer, keeping its memory.
+    void clear() {
+        used = 0;
+    }
+
+    // - Output: Returns the written bytes.
+    const uint8_t* getData() const {
+        return bytes.data();
+    }
+
+    // - Output: Returns the number of written bytes.
+    size_t getSize() const {
+        return used;
+    }
+
+private:
+    std::vector<uint8_t> bytes;  // Grows by doubling; only the first used bytes hold data
+    size_t used = 0;
+};
+
+class StateReader {
+public:
+    StateReader(const uint8_t* data, size_t size) : data(data), size(size), offset(0), failed(false) {}
+
+    /*
+    Reads the next value. Once a read runs past the end of the buffer the reader fails and every later read leaves
+    its target untouched.
+    - Output: Returns false if the reader has failed.
+    */
+    template <typename T>
+    bool read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be read");
+        return readBytes(&value, sizeof(T));
+    }
+
+    // Reads an array written by StateWriter::writeVector, refusing counts larger than the bytes left.
+    template <typename T>
+    bool readVector(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be read");
+        uint64_t count;
+        if (!read(count) || count > (size - offset) / sizeof(T)) {
+            failed = true;
+            return false;
+        }
+        values.resize(static_cast<size_t>(count));
+        return readBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    bool readBytes(void* target, size_t count) {
+        if (failed || count > size - offset) {
+            failed = true;
+            return false;
+        }
+        std::memcpy(target, data + offset, count);
+        offset += count;
+        return true;
+    }
+
+    // - Output: Returns true if every read so far succeeded.
+    bool isValid() const {
+        return !failed;
+    }
+
+    // - Output: Returns true once every byte has been read.
+    bool isAtEnd() const {
+        return offset == size;
+    }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    bool failed;
+};
+
+// - Output: Returns the 64-bit FNV-1a hash of a byte buffer.
+inline uint64_t hashBytes(const uint8_t* data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
@@ -0,0 +1,447 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Tests of the simulation core building blocks, run by ctest (centipede_tests). Each test function checks one piece:
+the swept collision test, the centipede follow kernel, level file parsing, the timer wheel, the triple buffer hand-off,
+the collision grid with many spiders, snapshot round trips and validation, and recording round trips with replay. A
+failed check prints its file, line and expression; the exit code is the number of failed checks, so 0 means every
+test passed.
+
+Usage: centipede_tests
+*/
+
+#include "AutoPlayer.h"
+#include "CentipedeKernels.h"
+#include "GameSnapshot.h"
+#include "GameWorld.h"
+#include "InputRecording.h"
+#include "TimerWheel.h"
+#include "TripleBuffer.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int failedChecks = 0;
+
+#define CHECK(expression)                                                                     \
+    do {                                                                                      \
+        if (!(expression)) {                                                                  \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #expression); \
+            ++failedChecks;                                                                   \
+        }                                                                                     \
+    } while (false)
+
+const float TEST_DELTA_TIME = 1.f / SIM_TICK_RATE;
+
+// Steps the world for a number of ticks with the AI player, stopping early when the game ends.
+static void playTicks(GameWorld& world, int ticks) {
+    AutoPlayer player;
+    for (int tick = 0; tick < ticks && !world.isFinished(); ++tick) {
+        world.step(player.decide(world, TEST_DELTA_TIME), TEST_DELTA_TIME);
+    }
+}
+
+// Writes a text file for the level parsing tests.
+static std::string writeFile(const std::string& path, const std::string& contents) {
+    std::ofstream out(path);
+    out << contents;
+    return path;
+}
+
+// sweepIntersects: overlap at the start, a hit during the tick with its time, a miss, and a fast mover that passes
+// through the target within one tick.
+static void testSweepIntersects() {
+    FloatRect target(100.f, 100.f, 10.f, 10.f);
+    float impact = -1.f;
+
+    CHECK(sweepIntersects(FloatRect(105.f, 105.f, 2.f, 2.f), Vec2f(0.f, 0.f), target, impact));
+    CHECK(impact == 0.f);
+
+    CHECK(sweepIntersects(FloatRect(80.f, 102.f, 10.f, 2.f), Vec2f(20.f, 0.f), target, impact));
+    CHECK(impact > 0.49f && impact < 0.51f);
+
+    CHECK(!sweepIntersects(FloatRect(80.f, 130.f, 10.f, 2.f), Vec2f(20.f, 0.f), target, impact));
+    CHECK(!sweepIntersects(FloatRect(80.f, 102.f, 10.f, 2.f), Vec2f(-20.f, 0.f), target, impact));
+
+    CHECK(sweepIntersects(FloatRect(102.f, 0.f, 2.f, 2.f), Vec2f(0.f, 500.f), target, impact));
+    CHECK(impact > 0.f && impact < 1.f);
+}
+
+// followSegments: a straight chain keeps its order and spacing with steps shorter and longer than the spacing.
+static void testFollowSegments() {
+    const float spacings[] = {5.f, 50.f};
+    for (float step : spacings) {
+        const size_t count = 12;
+        const float followDistance = 30.f;
+        std::vector<float> x(count);
+        std::vector<float> y(count, 0.f);
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = -followDistance * static_cast<float>(i);
+        }
+        bool ordered = true;
+        float maxGap = 0.f;
+        for (int tick = 0; tick < 200; ++tick) {
+            followSegments(x.data(), y.data(), count, std::max(0.f, followDistance - step), step);
+            x[0] += step;
+            for (size_t i = 1; i < count; ++i) {
+                ordered = ordered && x[i] < x[i - 1];
+                maxGap = std::max(maxGap, x[i - 1] - x[i]);
+            }
+        }
+        CHECK(ordered);
+        CHECK(maxGap <= std::max(followDistance, step) + 0.01f);
+    }
+}
+
+// GameConfig::load: a valid file, and files with errors that must be rejected without changing the config.
+static void testGameConfig() {
+    GameConfig config;
+    std::string error;
+    CHECK(config.load(writeFile("test_valid.level", "# comment\nworld_width = 1200\n\nspiders = 3\nship_speed = 250.5\n"),
+                      error));
+    CHECK(config.worldWidth == 1200 && config.spiderCount == 3 && config.shipSpeed == 250.5f);
+
+    const char* badFiles[] = {
+        "unknown_key = 1\n",
+        "mushrooms = many\n",
+        "mushrooms 30\n",
+        "mushrooms = 30 40\n",
+        "world_width = 50\n",
+        "centipedes = 0\n",
+        "ship_speed = -1\n",
+    };
+    for (const char* contents : badFiles) {
+        GameConfig before = config;
+        error.clear();
+        CHECK(!config.load(writeFile("test_bad.level", contents), error));
+        CHECK(!error.empty());
+        CHECK(config.worldWidth == before.worldWidth && config.mushroomCount == before.mushroomCount &&
+              config.centipedeCount == before.centipedeCount && config.shipSpeed == before.shipSpeed);
+    }
+    CHECK(!config.load("test_missing.level", error));
+    std::remove("test_valid.level");
+    std::remove("test_bad.level");
+}
+
+// TimerWheel: due ticks across laps, firing order, timers scheduled while firing, a full pool, tick conversion and a
+// save and load in the middle of a run.
+static void testTimerWheel() {
+    TimerWheel wheel;
+    wheel.reset(8);
+    const uint32_t delays[] = {1, 255, 256, 257, 1000};
+    for (uint32_t i = 0; i < 5; ++i) {
+        CHECK(wheel.schedule(delays[i], 0, i));
+    }
+    std::vector<uint64_t> firedAt(5, 0);
+    for (int tick = 0; tick < 1100; ++tick) {
+        wheel.advance([&](uint16_t, uint32_t data) { firedAt[data] = wheel.getTick(); });
+    }
+    for (uint32_t i = 0; i < 5; ++i) {
+        CHECK(firedAt[i] == delays[i]);
+    }
+    CHECK(wheel.getPendingCount() == 0);
+
+    // Timers due in the same tick fire in scheduling order; one scheduled by the handler waits for a later tick
+    wheel.clear();
+    std::vector<uint32_t> order;
+    wheel.schedule(3, 0, 10);
+    wheel.schedule(3, 0, 11);
+    wheel.schedule(3, 1, 12);
+    for (int tick = 0; tick < 6; ++tick) {
+        wheel.advance([&](uint16_t kind, uint32_t data) {
+            order.push_back(data);
+            if (kind == 1) {
+                wheel.schedule(1, 0, 13);
+            }
+        });
+    }
+    CHECK((order == std::vector<uint32_t>{10, 11, 12, 13}));
+
+    wheel.clear();
+    for (int i = 0; i < 8; ++i) {
+        CHECK(wheel.schedule(10, 0, 0));
+    }
+    CHECK(!wheel.schedule(10, 0, 0));
+
+    CHECK(TimerWheel::secondsToTicks(0.1f, 1.f / 120.f) == 12);
+    CHECK(TimerWheel::secondsToTicks(0.f, 1.f / 120.f) == 1);
+    CHECK(TimerWheel::secondsToTicks(2.f, 1.f / 30.f) == 60);
+
+    // A restored wheel fires the same timers at the same ticks
+    wheel.clear();
+    wheel.schedule(300, 0, 1);
+    wheel.schedule(40, 0, 2);
+    for (int tick = 0; tick < 20; ++tick) {
+        wheel.advance([](uint16_t, uint32_t) {});
+    }
+    StateWriter writer;
+    wheel.saveState(writer);
+    TimerWheel restored;
+    restored.reset(8);
+    StateReader reader(writer.getData(), writer.getSize());
+    CHECK(restored.loadState(reader));
+    CHECK(restored.getTick() == 20 && restored.getPendingCount() == 2);
+    std::vector<uint64_t> restoredFiredAt(3, 0);
+    for (int tick = 0; tick < 400; ++tick) {
+        restored.advance([&](uint16_t, uint32_t data) { restoredFiredAt[data] = restored.getTick(); });
+    }
+    CHECK(restoredFiredAt[1] == 300 && restoredFiredAt[2] == 40);
+}
+
+// A value whose fields must always agree, to detect a torn read
+struct Counter {
+    uint64_t value = 0;
+    uint64_t copies[16] = {};
+};
+
+// TripleBuffer: nothing to take before a publish, only the latest of several publishes is taken, and a consumer
+// thread never sees a torn or older value while a producer thread publishes.
+static void testTripleBuffer() {
+    TripleBuffer<Counter> buffer;
+    CHECK(!buffer.acquire());
+    for (uint64_t value = 1; value <= 3; ++value) {
+        buffer.getWriteBuffer().value = value;
+        buffer.publish();
+    }
+    CHECK(buffer.acquire());
+    CHECK(buffer.getReadBuffer().value == 3);
+    CHECK(!buffer.acquire());
+    CHECK(buffer.getReadBuffer().value == 3);
+
+    const uint64_t PUBLISHES = 200000;
+    std::atomic<bool> done(false);
+    std::thread producer([&]() {
+        for (uint64_t value = 4; value < 4 + PUBLISHES; ++value) {
+            Counter& counter = buffer.getWriteBuffer();
+            counter.value = value;
+            for (uint64_t& copy : counter.copies) {
+                copy = value;
+            }
+            buffer.publish();
+        }
+        done.store(true);
+    });
+    uint64_t last = 3;
+    bool consistent = true;
+    bool increasing = true;
+    while (!done.load()) {
+        if (!buffer.acquire()) {
+            continue;
+        }
+        const Counter& counter = buffer.getReadBuffer();
+        for (uint64_t copy : counter.copies) {
+            consistent = consistent && copy == counter.value;
+        }
+        increasing = increasing && counter.value > last;
+        last = counter.value;
+    }
+    producer.join();
+    buffer.acquire();
+    CHECK(consistent);
+    CHECK(increasing);
+    CHECK(buffer.getReadBuffer().value == 3 + PUBLISHES);
+}
+
+// GameWorld collision grid: with enough lasers in flight to build it, every laser put on a spider kills that spider and
+// a spaceship put on a spider loses a life.
+static void testSpiderBroadphase() {
+    GameWorld world;
+    world.config.worldWidth = 4000;
+    world.config.worldHeight = 2000;
+    world.config.mushroomCount = 0;
+    world.config.spiderCount = 64;
+    world.reset(5);
+    world.step(InputState(), TEST_DELTA_TIME);
+
+    // Spiders far enough apart that each laser can only reach its own
+    std::vector<size_t> targets;
+    for (size_t s = 0; s < world.spiders.size() && targets.size() < 24; ++s) {
+        bool apart = world.spiders[s].getIsAlive() && world.spiders[s].position.y > world.config.topBuffer + 100.f;
+        for (size_t t : targets) {
+            Vec2f offset = world.spiders[s].position - world.spiders[t].position;
+            apart = apart && (std::abs(offset.x) > 80.f || std::abs(offset.y) > 80.f);
+        }
+        if (apart) {
+            targets.push_back(s);
+        }
+    }
+    CHECK(targets.size() >= 16);
+    for (size_t t : targets) {
+        const Spider& spider = world.spiders[t];
+        world.lasers.spawn(world.sizes.laser, spider.position.x + spider.size.x / 2.f,
+                           spider.position.y + spider.size.y / 2.f);
+    }
+    size_t spare = 0;
+    while (spare < world.spiders.size() &&
+           (std::find(targets.begin(), targets.end(), spare) != targets.end() || !world.spiders[spare].getIsAlive())) {
+        ++spare;
+    }
+    CHECK(spare < world.spiders.size());
+    world.spaceshipPosition = world.spiders[spare].position;
+
+    int score = world.score;
+    int lives = world.lives;
+    world.step(InputState(), TEST_DELTA_TIME);
+    bool targetsKilled = true;
+    for (size_t t : targets) {
+        targetsKilled = targetsKilled && !world.spiders[t].getIsAlive();
+    }
+    CHECK(targetsKilled);
+    CHECK(world.score == score + 300 * static_cast<int>(targets.size()));
+    CHECK(world.lives == lives - 1);
+}
+
+// GameSnapshot: a restored world, in memory or through a file, continues exactly like the original, also into a
+// world of another level, and a corrupted snapshot is rejected.
+static void testSnapshotRoundTrip() {
+    GameWorld world;
+    world.config.spiderCount = 3;
+    world.reset(7);
+    playTicks(world, 600);
+
+    GameSnapshot snapshot;
+    snapshot.capture(world);
+    CHECK(snapshot.save("test.csnp"));
+    playTicks(world, 600);
+    uint64_t expected = world.computeStateHash();
+
+    GameWorld restored;
+    CHECK(snapshot.restore(restored));
+    playTicks(restored, 600);
+    CHECK(restored.computeStateHash() == expected);
+
+    GameSnapshot loaded;
+    CHECK(loaded.load("test.csnp"));
+    GameWorld other;
+    other.config.centipedeCount = 40;
+    other.reset(1);
+    CHECK(loaded.restore(other));
+    CHECK(other.config.spiderCount == 3);
+    playTicks(other, 600);
+    CHECK(other.computeStateHash() == expected);
+
+    std::ofstream("test.csnp", std::ios::binary) << "CSNPgarbage";
+    CHECK(loaded.load("test.csnp"));
+    CHECK(!loaded.restore(other));
+    std::remove("test.csnp");
+}
+
+// GameWorld::loadState: states cut short anywhere and centipedes whose segment ranges overlap or are empty are
+// rejected.
+static void testSnapshotValidation() {
+    GameWorld world;
+    world.config.centipedeCount = 2;
+    world.reset(3);
+    playTicks(world, 200);
+    StateWriter writer;
+    world.saveState(writer);
+
+    GameWorld restored;
+    bool rejected = true;
+    for (size_t cut = 0; cut < writer.getSize(); cut += (cut + 64 < writer.getSize() ? 97 : 1)) {
+        StateReader reader(writer.getData(), cut);
+        rejected = rejected && !restored.loadState(reader);
+    }
+    CHECK(rejected);
+    StateReader reader(writer.getData(), writer.getSize());
+    CHECK(restored.loadState(reader));
+
+    GameSnapshot snapshot;
+    CHECK(world.centipedes.size() == 2);
+    ECE_Centipede second = world.centipedes[1];
+    world.centipedes[1] = world.centipedes[0];
+    snapshot.capture(world);
+    CHECK(!snapshot.restore(restored));
+
+    world.centipedes[1] = ECE_Centipede();
+    snapshot.capture(world);
+    CHECK(!snapshot.restore(restored));
+
+    world.centipedes[1] = second;
+    snapshot.capture(world);
+    CHECK(snapshot.restore(restored));
+}
+
+// InputRecording: a recorded game survives a save and load with its runs, and replaying it ends in the recorded state.
+static void testRecordingRoundTrip() {
+    GameConfig config;
+    config.spiderCount = 2;
+    GameWorld world(EntitySizes(), config);
+    world.reset(11);
+    InputRecording recording;
+    recording.begin(11, world.config, TEST_DELTA_TIME);
+    AutoPlayer player;
+    for (int tick = 0; tick < 5000 && !world.isFinished(); ++tick) {
+        InputState input = player.decide(world, TEST_DELTA_TIME);
+        recording.record(input);
+        world.step(input, TEST_DELTA_TIME);
+    }
+    recording.end(world);
+    CHECK(recording.getRuns().size() < recording.getTickCount());
+    CHECK(recording.save("test.crec"));
+
+    InputRecording loaded;
+    CHECK(loaded.load("test.crec"));
+    CHECK(loaded.getSeed() == 11 && loaded.getTickCount() == recording.getTickCount());
+    CHECK(loaded.getRuns().size() == recording.getRuns().size());
+    CHECK(loaded.getConfig().spiderCount == 2);
+
+    GameWorld replayed(EntitySizes(), loaded.getConfig());
+    replayed.reset(loaded.getSeed());
+    for (const InputRun& run : loaded.getRuns()) {
+        for (uint32_t tick = 0; tick < run.ticks; ++tick) {
+            replayed.step(unpackKeys(run.keys), loaded.getDeltaTime());
+        }
+    }
+    CHECK(replayed.score == loaded.getFinalScore());
+    CHECK(replayed.computeStateHash() == loaded.getFinalStateHash());
+
+    std::ofstream("test.crec", std::ios::binary) << "CREC";
+    CHECK(!loaded.load("test.crec"));
+
+    // A recording of another game cut short in its runs is rejected without touching the loaded one
+    InputRecording other;
+    other.begin(12, GameConfig(), 1.f / 60.f);
+    InputState fire;
+    fire.fire = true;
+    for (int tick = 0; tick < 100; ++tick) {
+        other.record(tick % 10 < 5 ? fire : InputState());
+    }
+    GameWorld otherWorld;
+    other.end(otherWorld);
+    CHECK(other.save("test.crec"));
+    std::ifstream in("test.crec", std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream("test.crec", std::ios::binary | std::ios::trunc) << bytes.substr(0, bytes.size() - 3);
+    CHECK(!loaded.load("test.crec"));
+    CHECK(loaded.getSeed() == 11 && loaded.getDeltaTime() == TEST_DELTA_TIME);
+    CHECK(loaded.getTickCount() == recording.getTickCount() && loaded.getRuns().size() == recording.getRuns().size());
+    CHECK(loaded.getConfig().spiderCount == 2);
+    std::remove("test.crec");
+}
+
+int main() {
+    testSweepIntersects();
+    testFollowSegments();
+    testGameConfig();
+    testTimerWheel();
+    testTripleBuffer();
+    testSpiderBroadphase();
+    testSnapshotRoundTrip();
+    testSnapshotValidation();
+    testRecordingRoundTrip();
+    if (failedChecks == 0) {
+        std::printf("all tests passed\n");
+    }
+    return failedChecks;
+}
@@ -0,0 +1,139 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Loading and shelf packing of the texture atlas.
+*/
+
+#include "TextureAtlas.h"
+#include "AssetBundle.h"
+#include <algorithm>
+#include <vector>
+
+const int ATLAS_PADDING = 1;   // Transparent pixels kept between images so filtering never bleeds across sprites
+const int ATLAS_WIDTH = 2048;  // Widest atlas we build; every GPU we target supports at least this size
+
+const char* getSpriteFileName(SpriteId id) {
+    static const char* const fileNames[SPRITE_COUNT] = {
+        "CentipedeHead.png",
+        "CentipedeBody.png",
+        "Mushroom0.png",
+        "Mushroom1.png",
+        "StarShip.png",
+        "LaserClass.png",
+        "spider.png",
+        "Startup Screen BackGround.png",
+    };
+    return fileNames[id];
+}
+
+/*
+Packs images into one atlas image using shelves: images are sorted by height and placed left to right, starting a new
+shelf below when a row is full.
+- Input: images to pack and their count, atlas receives the packed image, rects receives the rectangle of every image.
+- Output: Returns false if an image is wider than the largest atlas we build.
+*/
+bool packAtlas(const sf::Image* images, int count, sf::Image& atlas, sf::IntRect* rects) {
+    std::vector<int> order(count);
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [images](int a, int b) {
+        return images[a].getSize().y > images[b].getSize().y;
+    });
+
+    int width = ATLAS_WIDTH;
+    int x = 0;
+    int y = 0;
+    int shelfHeight = 0;
+    for (int index : order) {
+        int imageWidth = static_cast<int>(images[index].getSize().x);
+        int imageHeight = static_cast<int>(images[index].getSize().y);
+        if (imageWidth > width) {
+            return false;
+        }
+        if (x + imageWidth > width) {
+            // Start a new shelf
+            x = 0;
+            y += shelfHeight + ATLAS_PADDING;
+            shelfHeight = 0;
+        }
+        rects[index] = sf::IntRect(x, y, imageWidth, imageHeight);
+        x += imageWidth + ATLAS_PADDING;
+        shelfHeight = std::max(shelfHeight, imageHeight);
+    }
+
+    int height = y + shelfHeight;
+    atlas.create(width, height, sf::Color::Transparent);
+    for (int i = 0; i < count; ++i) {
+        atlas.copy(images[i], rects[i].left, rects[i].top);
+    }
+    return true;
+}
+
+/*
+Loads every sprite image from a directory and packs them into one atlas image.
+- Input: directory holding the PNG files, for example "graphics/", atlas receives the packed image, rects receives the
+  rectangle of every sprite.
+- Output: Returns false if any image cannot be loaded or the atlas cannot be built.
+*/
+bool packAtlasFiles(const std::string& directory, sf::Image& atlas, sf::IntRect* rects) {
+    sf::Image images[SPRITE_COUNT];
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        if (!images[i].loadFromFile(directory + getSpriteFileName(static_cast<SpriteId>(i)))) {
+            return false;
+        }
+    }
+    return packAtlas(images, SPRITE_COUNT, atlas, rects);
+}
+
+/*
+Loads every sprite image from a directory and uploads the packed atlas.
+- Input: directory holding the PNG files, for example "graphics/".
+- Output: Returns false if any image cannot be loaded or the atlas cannot be built.
+*/
+bool TextureAtlas::loadFromFiles(const std::string& directory) {
+    sf::Image atlas;
+    sf::IntRect packedRects[SPRITE_COUNT];
+    return packAtlasFiles(directory, atlas, packedRects) && loadFromImage(atlas, packedRects);
+}
+
+/*
+Uploads an atlas image packed by packAtlas().
+- Input: atlas image and the rectangle of every sprite in it.
+- Output: Returns false if the atlas is too large for this GPU or the texture cannot be created.
+*/
+bool TextureAtlas::loadFromImage(const sf::Image& atlas, const sf::IntRect* rects) {
+    if (!fitsTexture(atlas.getSize().x, atlas.getSize().y) || !texture.loadFromImage(atlas)) {
+        return false;
+    }
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        this->rects[i] = rects[i];
+    }
+    return true;
+}
+
+/*
+Uploads the atlas packed at build time. The pixels go to the texture straight from the mapped bundle.
+- Input: bundle opened with AssetBundle::open().
+- Output: Returns false if the atlas is too large for this GPU or the texture cannot be created.
+*/
+bool TextureAtlas::loadFromBundle(const AssetBundle& bundle) {
+    unsigned int width = bundle.getAtlasWidth();
+    unsigned int height = bundle.getAtlasHeight();
+    if (!fitsTexture(width, height) || !texture.create(width, height)) {
+        return false;
+    }
+    texture.update(bundle.getAtlasPixels());
+    for (int i = 0; i < SPRITE_COUNT; ++i) {
+        rects[i] = bundle.getRect(static_cast<SpriteId>(i));
+    }
+    return true;
+}
+
+// - Output: Returns true if a texture of the given size is supported by the GPU.
+bool TextureAtlas::fitsTexture(unsigned int width, unsigned int height) {
+    return width <= sf::Texture::getMaximumSize() && height <= sf::Texture::getMaximumSize();
+}
@@ -0,0 +1,68 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+The TextureAtlas packs every game image into a single texture so all sprites can be drawn from one texture bind.
+Sprites are addressed by SpriteId and each one maps to a rectangle inside the atlas. The atlas is normally loaded
+already packed from the asset bundle; loading the loose PNG files is the fallback.
+*/
+
+#pragma once
+
+#include "GameMath.h"
+#include <SFML/Graphics.hpp>
+#include <string>
+
+class AssetBundle;
+
+// Every image packed into the atlas
+enum SpriteId {
+    SPRITE_CENTIPEDE_HEAD,
+    SPRITE_CENTIPEDE_BODY,
+    SPRITE_MUSHROOM,
+    SPRITE_MUSHROOM_SMALL,
+    SPRITE_SPACESHIP,
+    SPRITE_LASER,
+    SPRITE_SPIDER,
+    SPRITE_START_SCREEN,
+    SPRITE_COUNT
+};
+
+// - Output: Returns the file name of the image for a sprite, relative to the graphics directory.
+const char* getSpriteFileName(SpriteId id);
+
+// Packs images into one atlas image and reports where each image went.
+bool packAtlas(const sf::Image* images, int count, sf::Image& atlas, sf::IntRect* rects);
+
+// Decodes every sprite image from a directory and packs them; needs no GPU, so it can run on any thread.
+bool packAtlasFiles(const std::string& directory, sf::Image& atlas, sf::IntRect* rects);
+
+class TextureAtlas {
+public:
+    bool loadFromFiles(const std::string& directory);
+    bool loadFromImage(const sf::Image& atlas, const sf::IntRect* rects);
+    bool loadFromBundle(const AssetBundle& bundle);
+
+    // - Output: Returns the texture holding every sprite.
+    const sf::Texture& getTexture() const {
+        return texture;
+    }
+
+    // - Output: Returns the rectangle of a sprite inside the atlas texture.
+    const sf::IntRect& getRect(SpriteId id) const {
+        return rects[id];
+    }
+
+    // - Output: Returns the size of a sprite in pixels.
+    Vec2f getSize(SpriteId id) const {
+        return Vec2f(static_cast<float>(rects[id].width), static_cast<float>(rects[id].height));
+    }
+
+private:
+    static bool fitsTexture(unsigned int width, unsigned int height);
+
+    sf::Texture texture;
+    sf::IntRect rects[SPRITE_COUNT];
+};
@@ -0,0 +1,134 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the work-stealing thread pool.
+*/
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+/*
+Starts the worker threads. The thread that calls parallelFor() is counted as one of the threads.
+- Input: threadCount is the total number of threads; values below 1 are treated as 1 (no workers).
+*/
+ThreadPool::ThreadPool(int threadCount)
+    : generation(0), stopping(false), function(nullptr), body(nullptr), count(0), grain(1), remaining(0) {
+    int total = std::max(1, threadCount);
+    queues.reset(new ChunkQueue[total]);
+    workers.reserve(total - 1);
+    for (int i = 1; i < total; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/*
+Runs one parallel loop and waits for it. A loop that fits in one chunk, or a pool without workers, runs directly on
+the calling thread.
+*/
+void ThreadPool::run(size_t count, size_t grain, RangeFunction function, const void* body) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<size_t>(1, grain);
+    size_t chunks = (count + grain - 1) / grain;
+    if (workers.empty() || chunks == 1) {
+        function(body, 0, count, 0);
+        return;
+    }
+
+    this->function = function;
+    this->body = body;
+    this->count = count;
+    this->grain = grain;
+    remaining.store(chunks, std::memory_order_relaxed);
+
+    // Give every thread a contiguous share of the chunks
+    size_t threads = workers.size() + 1;
+    for (size_t t = 0; t < threads; ++t) {
+        std::lock_guard<std::mutex> guard(queues[t].lock);
+        queues[t].head = chunks * t / threads;
+        queues[t].tail = chunks * (t + 1) / threads;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        ++generation;
+    }
+    wake.notify_all();
+
+    runChunks(0);
+    while (remaining.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield(); // Another thread is finishing its last chunk
+    }
+}
+
+/*
+Main loop of a worker thread: sleep until a loop starts, run chunks until none are left, repeat until the pool stops.
+- Input: threadIndex of the worker.
+*/
+void ThreadPool::workerLoop(int threadIndex) {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(mutex);
+            wake.wait(guard, [&] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+        runChunks(threadIndex);
+    }
+}
+
+// Runs chunks, own ones first and then stolen ones, until every queue is empty.
+void ThreadPool::runChunks(int threadIndex) {
+    size_t chunk;
+    while (takeChunk(threadIndex, chunk)) {
+        size_t begin = chunk * grain;
+        size_t end = std::min(count, begin + grain);
+        function(body, begin, end, threadIndex);
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+/*
+Takes the next chunk of a thread's own queue, or steals the last chunk of another thread's queue.
+- Input: threadIndex of the calling thread, chunk receives the chunk index.
+- Output: Returns false once no queue holds any chunk.
+*/
+bool ThreadPool::takeChunk(int threadIndex, size_t& chunk) {
+    {
+        ChunkQueue& own = queues[threadIndex];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (own.head < own.tail) {
+            chunk = own.head++;
+            return true;
+        }
+    }
+
+    int threads = getThreadCount();
+    for (int offset = 1; offset < threads; ++offset) {
+        ChunkQueue& victim = queues[(threadIndex + offset) % threads];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (victim.head < victim.tail) {
+            chunk = --victim.tail;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,82 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Work-stealing thread pool for data-parallel loops. parallelFor() cuts an index range into chunks, gives each thread a
+contiguous share of the chunks and lets threads that run out take chunks from the back of another thread's share. The
+calling thread works too and the call returns once every chunk has run. No memory is allocated per call, so the pool
+can be used every tick.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    explicit ThreadPool(int threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // - Output: Returns the number of threads that run chunks, the calling thread included.
+    int getThreadCount() const {
+        return static_cast<int>(workers.size()) + 1;
+    }
+
+    /*
+    Runs body(begin, end, threadIndex) over [0, count) in chunks of grain indices, spread over the pool. threadIndex is
+    in [0, getThreadCount()) and lets the body write to per-thread buffers without locking. Which thread runs which
+    chunk is not fixed, so results must not depend on it.
+    - Input: count of indices, grain is the chunk size, body is called once per chunk.
+    */
+    template <typename Body>
+    void parallelFor(size_t count, size_t grain, const Body& body) {
+        run(count, grain, &invokeBody<Body>, &body);
+    }
+
+private:
+    typedef void (*RangeFunction)(const void* body, size_t begin, size_t end, int threadIndex);
+
+    // Chunks owned by one thread: the owner takes from head, thieves take from tail
+    struct alignas(64) ChunkQueue {
+        std::mutex lock;
+        size_t head = 0;
+        size_t tail = 0;
+    };
+
+    template <typename Body>
+    static void invokeBody(const void* body, size_t begin, size_t end, int threadIndex) {
+        (*static_cast<const Body*>(body))(begin, end, threadIndex);
+    }
+
+    void run(size_t count, size_t grain, RangeFunction function, const void* body);
+    void workerLoop(int threadIndex);
+    void runChunks(int threadIndex);
+    bool takeChunk(int threadIndex, size_t& chunk);
+
+    std::vector<std::thread> workers;
+    std::unique_ptr<ChunkQueue[]> queues;   // One per thread, index 0 is the calling thread
+
+    std::mutex mutex;                       // Guards generation and stopping
+    std::condition_variable wake;           // Signals workers that a new loop started or the pool stops
+    uint64_t generation;                    // Number of loops started, workers run chunks when it changes
+    bool stopping;
+
+    // The loop being run; written before its chunks are queued
+    RangeFunction function;
+    const void* body;
+    size_t count;
+    size_t grain;
+    std::atomic<size_t> remaining;          // Chunks of the current loop that have not finished
+};
@@ -0,0 +1,124 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Implementation of the simulation-time timer wheel.
+*/
+
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cmath>
+
+// Fraction of a tick ignored when converting seconds to ticks, so a delay that is a whole number of ticks apart from
+// float rounding (0.1 s at 120 Hz) is not stretched by a tick
+const double TICK_ROUNDING = 1e-3;
+const uint32_t MAX_DELAY_TICKS = UINT32_MAX / 2; // Longest delay, far beyond any game
+
+TimerWheel::TimerWheel() : freeHead(NO_TIMER), pendingCount(0), currentTick(0) {
+    std::fill(slotHead, slotHead + SLOT_COUNT, NO_TIMER);
+    std::fill(slotTail, slotTail + SLOT_COUNT, NO_TIMER);
+}
+
+/*
+Sizes the timer pool and removes every timer. A pool of the same capacity as before is reused without allocating.
+- Input: capacity is the most timers pending at once.
+*/
+void TimerWheel::reset(size_t capacity) {
+    timers.resize(capacity);
+    clear();
+}
+
+// Removes every timer and starts counting ticks from zero again.
+void TimerWheel::clear() {
+    std::fill(slotHead, slotHead + SLOT_COUNT, NO_TIMER);
+    std::fill(slotTail, slotTail + SLOT_COUNT, NO_TIMER);
+    freeHead = NO_TIMER;
+    for (size_t i = timers.size(); i-- > 0;) {
+        timers[i].next = freeHead;
+        freeHead = static_cast<uint32_t>(i);
+    }
+    pendingCount = 0;
+    currentTick = 0;
+}
+
+/*
+Schedules a timer to fire a number of ticks from the current one.
+- Input: delayTicks until the timer fires, at least 1 (0 is treated as 1); kind and data are handed to the handler.
+- Output: Returns false if the pool is full and the timer was dropped.
+*/
+bool TimerWheel::schedule(uint32_t delayTicks, uint16_t kind, uint32_t data) {
+    if (freeHead == NO_TIMER) {
+        return false;
+    }
+    uint32_t timer = freeHead;
+    Timer& entry = timers[timer];
+    freeHead = entry.next;
+    entry.dueTick = currentTick + std::max(1u, std::min(delayTicks, MAX_DELAY_TICKS));
+    entry.kind = kind;
+    entry.data = data;
+    append(static_cast<uint32_t>(entry.dueTick & (SLOT_COUNT - 1)), timer);
+    ++pendingCount;
+    return true;
+}
+
+// Adds a timer at the end of the list of a slot.
+void TimerWheel::append(uint32_t slot, uint32_t timer) {
+    timers[timer].next = NO_TIMER;
+    if (slotTail[slot] == NO_TIMER) {
+        slotHead[slot] = timer;
+    } else {
+        timers[slotTail[slot]].next = timer;
+    }
+    slotTail[slot] = timer;
+}
+
+/*
+Converts a duration to the number of ticks a timer has to wait for it.
+- Input: seconds of the duration, deltaTime is the length of a tick.
+- Output: Returns the number of whole ticks that cover the duration, at least 1.
+*/
+uint32_t TimerWheel::secondsToTicks(float seconds, float deltaTime) {
+    double ticks = std::ceil(static_cast<double>(seconds) / deltaTime - TICK_ROUNDING);
+    return static_cast<uint32_t>(std::max(1.0, std::min(ticks, static_cast<double>(MAX_DELAY_TICKS))));
+}
+
+// - Input: writer receives the current tick and every pending timer, slot by slot in firing order.
+void TimerWheel::saveState(StateWriter& writer) const {
+    writer.write(currentTick);
+    writer.write<uint64_t>(pendingCount);
+    for (uint32_t slot = 0; slot < SLOT_COUNT; ++slot) {
+        for (uint32_t timer = slotHead[slot]; timer != NO_TIMER; timer = timers[timer].next) {
+            writer.write(timers[timer].dueTick);
+            writer.write(timers[timer].kind);
+            writer.write(timers[timer].data);
+        }
+    }
+}
+
+/*
+Restores the timers written by saveState() into the current pool.
+- Input: reader positioned at the timer state.
+- Output: Returns false if the state is cut short, does not fit the pool or holds a timer that is already past due.
+*/
+bool TimerWheel::loadState(StateReader& reader) {
+    clear();
+    uint64_t count = 0;
+    if (!reader.read(currentTick) || !reader.read(count) || count > timers.size()) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+        uint32_t timer = freeHead;
+        Timer& entry = timers[timer];
+        freeHead = entry.next;
+        reader.read(entry.dueTick);
+        reader.read(entry.kind);
+        if (!reader.read(entry.data) || entry.dueTick <= currentTick) {
+            return false;
+        }
+        append(static_cast<uint32_t>(entry.dueTick & (SLOT_COUNT - 1)), timer);
+        ++pendingCount;
+    }
+    return true;
+}
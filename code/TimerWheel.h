@@ -0,0 +1,94 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Timer wheel for the timed events of a game, driven by simulation ticks instead of the wall clock, so timers stop while
+the game is paused and run at full speed in headless runs and replays. Timers are kept in a ring of SLOT_COUNT slots
+indexed by the tick they are due in; a timer due more than SLOT_COUNT ticks ahead stays in its slot for the extra laps.
+advance() moves to the next tick and only visits the slot of that tick, so its cost does not depend on how many timers
+are pending elsewhere. Timers live in a fixed pool sized by reset(), linked into per-slot lists by index, so
+scheduling and firing allocate nothing.
+
+A timer carries a kind and a data word (for example a spider respawn and the spider index) rather than a callback
+pointer, so pending timers can be saved in a snapshot; advance() hands every due timer to a handler.
+*/
+
+#pragma once
+
+#include "StateStream.h"
+#include <cstdint>
+#include <vector>
+
+class TimerWheel {
+public:
+    static constexpr uint32_t SLOT_COUNT = 256;      // Ticks covered by one lap of the wheel, a power of two
+    static constexpr uint32_t NO_TIMER = UINT32_MAX; // End of a timer list
+
+    TimerWheel();
+
+    void reset(size_t capacity);
+    void clear();
+    bool schedule(uint32_t delayTicks, uint16_t kind, uint32_t data);
+    void saveState(StateWriter& writer) const;
+    bool loadState(StateReader& reader);
+
+    static uint32_t secondsToTicks(float seconds, float deltaTime);
+
+    /*
+    Moves to the next tick and fires the timers due in it, in the order they were scheduled. The handler may schedule
+    new timers; those never fire in the same call.
+    - Input: handler is called as handler(kind, data) for every due timer, after the timer has been freed.
+    */
+    template <typename Handler>
+    void advance(const Handler& handler) {
+        ++currentTick;
+        uint32_t slot = static_cast<uint32_t>(currentTick & (SLOT_COUNT - 1));
+        uint32_t timer = slotHead[slot];
+        slotHead[slot] = slotTail[slot] = NO_TIMER;
+        while (timer != NO_TIMER) {
+            Timer& entry = timers[timer];
+            uint32_t next = entry.next;
+            if (entry.dueTick <= currentTick) {
+                uint16_t kind = entry.kind;
+                uint32_t data = entry.data;
+                entry.next = freeHead;
+                freeHead = timer;
+                --pendingCount;
+                handler(kind, data);
+            } else {
+                append(slot, timer); // Due in a later lap
+            }
+            timer = next;
+        }
+    }
+
+    // - Output: Returns the number of ticks advanced since the last reset() or clear().
+    uint64_t getTick() const {
+        return currentTick;
+    }
+
+    // - Output: Returns the number of timers waiting to fire.
+    size_t getPendingCount() const {
+        return pendingCount;
+    }
+
+private:
+    // One scheduled timer, or a free pool entry
+    struct Timer {
+        uint64_t dueTick;
+        uint32_t next;   // Next timer of the same slot, or of the free list
+        uint32_t data;
+        uint16_t kind;
+    };
+
+    void append(uint32_t slot, uint32_t timer);
+
+    std::vector<Timer> timers;        // Pool of every timer, allocated by reset()
+    uint32_t slotHead[SLOT_COUNT];    // First timer of every slot, in scheduling order
+    uint32_t slotTail[SLOT_COUNT];
+    uint32_t freeHead;                // First free pool entry
+    size_t pendingCount;
+    uint64_t currentTick;
+};
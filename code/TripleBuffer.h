@@ -0,0 +1,61 @@
+/*
+Author: Rahil Vasa
+Class: ECE4122
+Last Date Modified: 10/16/2026
+
+Description:
+Lock-free triple buffer that hands the latest value from one producer thread to one consumer thread. The producer
+fills its back buffer and publishes it by swapping it with the middle buffer; the consumer swaps its front buffer
+with the middle one when a newer value was published. Neither side ever waits for the other or sees a half-written
+value, and values the consumer did not take in time are replaced, never queued.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() : back(0), middle(1), front(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // - Output: Returns the buffer the producer fills next. It may hold any older value.
+    T& getWriteBuffer() {
+        return buffers[back];
+    }
+
+    // Makes the write buffer the latest value; the producer gets a buffer the consumer is not using in exchange.
+    void publish() {
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    /*
+    Takes the latest published value, if there is one the consumer has not taken yet.
+    - Output: Returns true if getReadBuffer() now holds a newer value.
+    */
+    bool acquire() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+            return false;
+        }
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    // - Output: Returns the value the consumer took last. It stays unchanged until the next acquire().
+    const T& getReadBuffer() const {
+        return buffers[front];
+    }
+
+private:
+    static constexpr uint32_t INDEX_MASK = 3; // Buffer index in the low bits of middle
+    static constexpr uint32_t FRESH = 4;      // Set in middle when it holds a value the consumer has not taken
+
+    T buffers[3];
+    uint32_t back;                            // Owned by the producer
+    alignas(64) std::atomic<uint32_t> middle;
+    alignas(64) uint32_t front;               // Owned by the consumer
+};